@@ -0,0 +1,74 @@
+-- Row width and scan speed of timestampandtz against timestamptz and
+-- timestampandtz8, with a narrow column either side of the value so the
+-- alignment padding shows up.  Run in a scratch database with the extension
+-- installed:
+--
+--   psql -X -f bench/layout.sql
+--
+-- Each timed query runs three times, compare the later runs.
+
+\set rows 1000000
+set client_min_messages = warning;
+set time zone 'US/Eastern';
+set max_parallel_workers_per_gather = 0;
+
+drop table if exists bench_timestamptz, bench_timestampandtz, bench_timestampandtz8;
+create table bench_timestamptz (flag bool, dt timestamptz, n int2);
+create table bench_timestampandtz (flag bool, dt timestampandtz, n int2);
+create table bench_timestampandtz8 (flag bool, dt timestampandtz8, n int2);
+
+insert into bench_timestamptz
+	select i % 2 = 0, timestamptz '2014-01-01 00:00 UTC' + i * interval '1 second', (i % 1000)::int2
+	from generate_series(1, :rows) i;
+insert into bench_timestampandtz select flag, dt, n from bench_timestamptz;
+insert into bench_timestampandtz8 select flag, dt::timestampandtz, n from bench_timestamptz;
+vacuum analyze bench_timestamptz, bench_timestampandtz, bench_timestampandtz8;
+
+-- bytes per row as stored (tuple header, padding and all) and heap size
+select 'timestamptz' as type, pg_column_size(t.dt) as value_bytes, avg(pg_column_size(t.*))::numeric(6,2) as row_bytes,
+		pg_size_pretty(pg_relation_size('bench_timestamptz')) as heap
+	from bench_timestamptz t group by 1, 2
+union all
+select 'timestampandtz', pg_column_size(t.dt), avg(pg_column_size(t.*))::numeric(6,2),
+		pg_size_pretty(pg_relation_size('bench_timestampandtz'))
+	from bench_timestampandtz t group by 1, 2
+union all
+select 'timestampandtz8', pg_column_size(t.dt), avg(pg_column_size(t.*))::numeric(6,2),
+		pg_size_pretty(pg_relation_size('bench_timestampandtz8'))
+	from bench_timestampandtz8 t group by 1, 2;
+
+\timing on
+
+\echo filtered scan
+select count(*) from bench_timestamptz where dt >= '2014-01-06 00:00 US/Eastern';
+select count(*) from bench_timestamptz where dt >= '2014-01-06 00:00 US/Eastern';
+select count(*) from bench_timestamptz where dt >= '2014-01-06 00:00 US/Eastern';
+select count(*) from bench_timestampandtz where dt >= '2014-01-06 00:00 @ US/Eastern';
+select count(*) from bench_timestampandtz where dt >= '2014-01-06 00:00 @ US/Eastern';
+select count(*) from bench_timestampandtz where dt >= '2014-01-06 00:00 @ US/Eastern';
+select count(*) from bench_timestampandtz8 where dt >= '2014-01-06 00:00 @ US/Eastern';
+select count(*) from bench_timestampandtz8 where dt >= '2014-01-06 00:00 @ US/Eastern';
+select count(*) from bench_timestampandtz8 where dt >= '2014-01-06 00:00 @ US/Eastern';
+
+\echo aggregate
+select max(dt) from bench_timestamptz;
+select max(dt) from bench_timestamptz;
+select max(dt) from bench_timestamptz;
+select max(dt) from bench_timestampandtz;
+select max(dt) from bench_timestampandtz;
+select max(dt) from bench_timestampandtz;
+
+\echo sort
+select count(*) from (select dt from bench_timestamptz order by dt desc offset 0) s;
+select count(*) from (select dt from bench_timestamptz order by dt desc offset 0) s;
+select count(*) from (select dt from bench_timestamptz order by dt desc offset 0) s;
+select count(*) from (select dt from bench_timestampandtz order by dt desc offset 0) s;
+select count(*) from (select dt from bench_timestampandtz order by dt desc offset 0) s;
+select count(*) from (select dt from bench_timestampandtz order by dt desc offset 0) s;
+select count(*) from (select dt from bench_timestampandtz8 order by dt desc offset 0) s;
+select count(*) from (select dt from bench_timestampandtz8 order by dt desc offset 0) s;
+select count(*) from (select dt from bench_timestampandtz8 order by dt desc offset 0) s;
+
+\timing off
+
+drop table bench_timestamptz, bench_timestampandtz, bench_timestampandtz8;
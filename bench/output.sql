@@ -0,0 +1,49 @@
+-- Text output speed of timestampandtz against timestamptz, as rows per second
+-- of COPY TO, in the ISO DateStyle (the fast path) and the Postgres one.
+-- COPY writes to /dev/null on the server, so run it as a superuser (or a
+-- member of pg_write_server_files) in a scratch database with the extension
+-- installed:
+--
+--   psql -X -f bench/output.sql
+--
+-- Each COPY runs three times, compare the later runs.
+
+\set rows 1000000
+set client_min_messages = notice;
+set time zone 'US/Eastern';
+
+drop table if exists bench_out_timestamptz, bench_out_timestampandtz;
+create table bench_out_timestamptz (dt timestamptz);
+create table bench_out_timestampandtz (dt timestampandtz);
+
+-- spread over several years and a few zones, with fractional seconds
+insert into bench_out_timestamptz
+	select timestamptz '2010-01-01 00:00 UTC' + i * interval '157.25 seconds'
+	from generate_series(1, :rows) i;
+insert into bench_out_timestampandtz
+	select tzmove(dt::timestampandtz, (array['US/Eastern', 'US/Pacific', 'Europe/London', 'Asia/Kolkata'])[i % 4 + 1])
+	from (select dt, row_number() over () as i from bench_out_timestamptz) s;
+vacuum analyze bench_out_timestamptz, bench_out_timestampandtz;
+
+create or replace function pg_temp.copy_rate(tab text) returns text language plpgsql as $$
+declare
+	started timestamptz;
+	copied bigint;
+	secs float8;
+begin
+	started := clock_timestamp();
+	execute format('copy %I to %L', tab, '/dev/null');
+	get diagnostics copied = row_count;
+	secs := extract(epoch from clock_timestamp() - started);
+	return format('%-26s %-9s %12s rows/sec', tab, current_setting('datestyle'), (copied / secs)::bigint);
+end $$;
+
+set datestyle = iso;
+select pg_temp.copy_rate('bench_out_timestamptz') from generate_series(1, 3);
+select pg_temp.copy_rate('bench_out_timestampandtz') from generate_series(1, 3);
+
+set datestyle = postgres;
+select pg_temp.copy_rate('bench_out_timestamptz') from generate_series(1, 3);
+select pg_temp.copy_rate('bench_out_timestampandtz') from generate_series(1, 3);
+
+drop table bench_out_timestamptz, bench_out_timestampandtz;
@@ -0,0 +1,88 @@
+#include "access/gin.h"
+#include "access/stratnum.h"
+
+/*
+ * GIN support in the style of btree_gin, so timestampandtz columns can join
+ * jsonb or tsvector columns in a multicolumn GIN index.  The keys are the
+ * values themselves ordered by timestampandtz_cmp, range strategies are
+ * partial matches that start at the query (or -infinity for < and <=) and
+ * stop once the utc time passes it.
+ */
+PG_FUNCTION_INFO_V1(timestampandtz_gin_extract_value);
+Datum timestampandtz_gin_extract_value(PG_FUNCTION_ARGS)
+{
+	int32 *nentries = (int32 *)PG_GETARG_POINTER(1);
+	Datum *entries = (Datum *)palloc(sizeof(Datum));
+
+	entries[0] = PG_GETARG_DATUM(0);
+	*nentries = 1;
+	PG_RETURN_POINTER(entries);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_gin_extract_query);
+Datum timestampandtz_gin_extract_query(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *query = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	int32 *nentries = (int32 *)PG_GETARG_POINTER(1);
+	StrategyNumber strategy = PG_GETARG_UINT16(2);
+	bool **partialmatch = (bool **)PG_GETARG_POINTER(3);
+	Pointer **extra_data = (Pointer **)PG_GETARG_POINTER(4);
+	Datum *entries = (Datum *)palloc(sizeof(Datum));
+
+	*nentries = 1;
+	*partialmatch = palloc(sizeof(bool));
+	(*partialmatch)[0] = strategy != BTEqualStrategyNumber;
+	/* comparePartial needs the query itself when the scan starts at -infinity */
+	*extra_data = palloc(sizeof(Pointer));
+	(*extra_data)[0] = (Pointer) query;
+
+	if(strategy == BTLessStrategyNumber || strategy == BTLessEqualStrategyNumber)
+	{
+		TimestampAndTz *leftmost = palloc(sizeof(TimestampAndTz));
+
+		leftmost->time = DT_NOBEGIN;
+		leftmost->tz = query->tz;
+		entries[0] = PointerGetDatum(leftmost);
+	}
+	else
+		entries[0] = PointerGetDatum(query);
+
+	PG_RETURN_POINTER(entries);
+}
+
+/* 0 is a match, less than zero skips the key and more than zero ends the scan */
+PG_FUNCTION_INFO_V1(timestampandtz_gin_compare_partial);
+Datum timestampandtz_gin_compare_partial(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *key = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	StrategyNumber strategy = PG_GETARG_UINT16(2);
+	TimestampAndTz *query = (TimestampAndTz *)PG_GETARG_POINTER(3);
+	int cmp = query->time > key->time ? 1 : (query->time < key->time ? -1 : 0);
+
+	switch(strategy)
+	{
+		case BTLessStrategyNumber:
+			PG_RETURN_INT32(cmp > 0 ? 0 : 1);
+		case BTLessEqualStrategyNumber:
+			PG_RETURN_INT32(cmp >= 0 ? 0 : 1);
+		case BTEqualStrategyNumber:
+			PG_RETURN_INT32(cmp != 0 ? 1 : 0);
+		case BTGreaterEqualStrategyNumber:
+			PG_RETURN_INT32(cmp <= 0 ? 0 : 1);
+		case BTGreaterStrategyNumber:
+			PG_RETURN_INT32(cmp < 0 ? 0 : (cmp == 0 ? -1 : 1));
+	}
+
+	elog(ERROR, "unrecognized strategy number: %d", strategy);
+	PG_RETURN_INT32(1);
+}
+
+/* the single key decides it, nothing to recheck */
+PG_FUNCTION_INFO_V1(timestampandtz_gin_consistent);
+Datum timestampandtz_gin_consistent(PG_FUNCTION_ARGS)
+{
+	bool *recheck = (bool *)PG_GETARG_POINTER(5);
+
+	*recheck = false;
+	PG_RETURN_BOOL(true);
+}
@@ -0,0 +1,235 @@
+#include "access/gist.h"
+#include "access/stratnum.h"
+#include "catalog/pg_type.h"
+
+/*
+ * GiST support in the style of btree_gist, so timestampandtz can sit in
+ * multicolumn GiST indexes and answer nearest-in-time (<->) scans.  Keys are
+ * the utc range [lower, upper] of everything below them, leaves have
+ * lower == upper.  The zone isn't kept in the key, so there is no fetch and
+ * no index-only scans.
+ */
+typedef struct TimestampAndTzKey {
+	Timestamp lower;
+	Timestamp upper;
+} TimestampAndTzKey;
+
+#define TimestampAndTzNotEqualStrategyNumber 6
+
+/* the storage type only ever lives inside the index */
+PG_FUNCTION_INFO_V1(timestampandtzkey_in);
+Datum timestampandtzkey_in(PG_FUNCTION_ARGS)
+{
+	ereport(ERROR,
+			(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+			 errmsg("cannot accept a value of type timestampandtzkey")));
+	PG_RETURN_VOID();
+}
+
+PG_FUNCTION_INFO_V1(timestampandtzkey_out);
+Datum timestampandtzkey_out(PG_FUNCTION_ARGS)
+{
+	ereport(ERROR,
+			(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
+			 errmsg("cannot display a value of type timestampandtzkey")));
+	PG_RETURN_VOID();
+}
+
+/* utc time of a query argument, which is a timestamptz for the cross-type operators */
+static Timestamp timestampandtz_gist_query(FunctionCallInfo fcinfo, Oid subtype)
+{
+	if(subtype == TIMESTAMPTZOID)
+		return PG_GETARG_TIMESTAMPTZ(1);
+	return ((TimestampAndTz *)PG_GETARG_POINTER(1))->time;
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_gist_consistent);
+Datum timestampandtz_gist_consistent(PG_FUNCTION_ARGS)
+{
+	GISTENTRY *entry = (GISTENTRY *)PG_GETARG_POINTER(0);
+	StrategyNumber strategy = (StrategyNumber)PG_GETARG_UINT16(2);
+	Timestamp query = timestampandtz_gist_query(fcinfo, PG_GETARG_OID(3));
+	bool *recheck = (bool *)PG_GETARG_POINTER(4);
+	TimestampAndTzKey *key = (TimestampAndTzKey *)DatumGetPointer(entry->key);
+
+	*recheck = false;
+
+	switch(strategy)
+	{
+		case BTLessStrategyNumber:
+			PG_RETURN_BOOL(key->lower < query);
+		case BTLessEqualStrategyNumber:
+			PG_RETURN_BOOL(key->lower <= query);
+		case BTEqualStrategyNumber:
+			PG_RETURN_BOOL(key->lower <= query && query <= key->upper);
+		case BTGreaterEqualStrategyNumber:
+			PG_RETURN_BOOL(key->upper >= query);
+		case BTGreaterStrategyNumber:
+			PG_RETURN_BOOL(key->upper > query);
+		case TimestampAndTzNotEqualStrategyNumber:
+			PG_RETURN_BOOL(!(key->lower == query && key->upper == query));
+	}
+
+	elog(ERROR, "unrecognized strategy number: %d", strategy);
+	PG_RETURN_BOOL(false);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_gist_union);
+Datum timestampandtz_gist_union(PG_FUNCTION_ARGS)
+{
+	GistEntryVector *entryvec = (GistEntryVector *)PG_GETARG_POINTER(0);
+	int *size = (int *)PG_GETARG_POINTER(1);
+	TimestampAndTzKey *out = palloc(sizeof(TimestampAndTzKey));
+	int i;
+
+	*out = *(TimestampAndTzKey *)DatumGetPointer(entryvec->vector[0].key);
+	for(i = 1; i < entryvec->n; i++)
+	{
+		TimestampAndTzKey *key = (TimestampAndTzKey *)DatumGetPointer(entryvec->vector[i].key);
+
+		if(key->lower < out->lower)
+			out->lower = key->lower;
+		if(key->upper > out->upper)
+			out->upper = key->upper;
+	}
+
+	*size = sizeof(TimestampAndTzKey);
+	PG_RETURN_POINTER(out);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_gist_compress);
+Datum timestampandtz_gist_compress(PG_FUNCTION_ARGS)
+{
+	GISTENTRY *entry = (GISTENTRY *)PG_GETARG_POINTER(0);
+	GISTENTRY *retval;
+	TimestampAndTzKey *key;
+
+	if(!entry->leafkey)
+		PG_RETURN_POINTER(entry);
+
+	key = palloc(sizeof(TimestampAndTzKey));
+	key->lower = key->upper = ((TimestampAndTz *)DatumGetPointer(entry->key))->time;
+
+	retval = palloc(sizeof(GISTENTRY));
+	gistentryinit(*retval, PointerGetDatum(key), entry->rel, entry->page, entry->offset, false);
+	PG_RETURN_POINTER(retval);
+}
+
+/* how far the original key has to stretch to take in the new one, in utc microseconds */
+PG_FUNCTION_INFO_V1(timestampandtz_gist_penalty);
+Datum timestampandtz_gist_penalty(PG_FUNCTION_ARGS)
+{
+	TimestampAndTzKey *orig = (TimestampAndTzKey *)DatumGetPointer(((GISTENTRY *)PG_GETARG_POINTER(0))->key);
+	TimestampAndTzKey *add = (TimestampAndTzKey *)DatumGetPointer(((GISTENTRY *)PG_GETARG_POINTER(1))->key);
+	float *penalty = (float *)PG_GETARG_POINTER(2);
+	float8 grow = 0;
+
+	if(add->lower < orig->lower)
+		grow += (float8) orig->lower - (float8) add->lower;
+	if(add->upper > orig->upper)
+		grow += (float8) add->upper - (float8) orig->upper;
+
+	*penalty = (float) grow;
+	PG_RETURN_POINTER(penalty);
+}
+
+typedef struct TimestampAndTzSplitItem {
+	OffsetNumber offset;
+	TimestampAndTzKey *key;
+} TimestampAndTzSplitItem;
+
+static int timestampandtz_split_cmp(const void *a, const void *b)
+{
+	const TimestampAndTzKey *left = ((const TimestampAndTzSplitItem *)a)->key;
+	const TimestampAndTzKey *right = ((const TimestampAndTzSplitItem *)b)->key;
+
+	if(left->lower != right->lower)
+		return left->lower < right->lower ? -1 : 1;
+	if(left->upper != right->upper)
+		return left->upper < right->upper ? -1 : 1;
+	return 0;
+}
+
+static void timestampandtz_split_add(TimestampAndTzKey **side, TimestampAndTzKey *key)
+{
+	if(*side == NULL)
+	{
+		*side = palloc(sizeof(TimestampAndTzKey));
+		**side = *key;
+		return;
+	}
+
+	if(key->lower < (*side)->lower)
+		(*side)->lower = key->lower;
+	if(key->upper > (*side)->upper)
+		(*side)->upper = key->upper;
+}
+
+/* order the entries by their lower bound and cut the list in half */
+PG_FUNCTION_INFO_V1(timestampandtz_gist_picksplit);
+Datum timestampandtz_gist_picksplit(PG_FUNCTION_ARGS)
+{
+	GistEntryVector *entryvec = (GistEntryVector *)PG_GETARG_POINTER(0);
+	GIST_SPLITVEC *v = (GIST_SPLITVEC *)PG_GETARG_POINTER(1);
+	OffsetNumber maxoff = entryvec->n - 1;
+	int n = maxoff - FirstOffsetNumber + 1;
+	TimestampAndTzSplitItem *items = palloc(n * sizeof(TimestampAndTzSplitItem));
+	TimestampAndTzKey *left = NULL, *right = NULL;
+	OffsetNumber i;
+
+	for(i = FirstOffsetNumber; i <= maxoff; i++)
+	{
+		items[i - FirstOffsetNumber].offset = i;
+		items[i - FirstOffsetNumber].key = (TimestampAndTzKey *)DatumGetPointer(entryvec->vector[i].key);
+	}
+	qsort(items, n, sizeof(TimestampAndTzSplitItem), timestampandtz_split_cmp);
+
+	v->spl_left = palloc(n * sizeof(OffsetNumber));
+	v->spl_right = palloc(n * sizeof(OffsetNumber));
+	v->spl_nleft = 0;
+	v->spl_nright = 0;
+
+	for(i = 0; i < n; i++)
+	{
+		if(i < n / 2)
+		{
+			v->spl_left[v->spl_nleft++] = items[i].offset;
+			timestampandtz_split_add(&left, items[i].key);
+		}
+		else
+		{
+			v->spl_right[v->spl_nright++] = items[i].offset;
+			timestampandtz_split_add(&right, items[i].key);
+		}
+	}
+
+	v->spl_ldatum = PointerGetDatum(left);
+	v->spl_rdatum = PointerGetDatum(right);
+	PG_RETURN_POINTER(v);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_gist_same);
+Datum timestampandtz_gist_same(PG_FUNCTION_ARGS)
+{
+	TimestampAndTzKey *a = (TimestampAndTzKey *)PG_GETARG_POINTER(0);
+	TimestampAndTzKey *b = (TimestampAndTzKey *)PG_GETARG_POINTER(1);
+	bool *result = (bool *)PG_GETARG_POINTER(2);
+
+	*result = a->lower == b->lower && a->upper == b->upper;
+	PG_RETURN_POINTER(result);
+}
+
+/* lower bound on the <-> distance of anything under the key, in utc microseconds */
+PG_FUNCTION_INFO_V1(timestampandtz_gist_distance);
+Datum timestampandtz_gist_distance(PG_FUNCTION_ARGS)
+{
+	GISTENTRY *entry = (GISTENTRY *)PG_GETARG_POINTER(0);
+	Timestamp query = ((TimestampAndTz *)PG_GETARG_POINTER(1))->time;
+	TimestampAndTzKey *key = (TimestampAndTzKey *)DatumGetPointer(entry->key);
+
+	if(query < key->lower)
+		PG_RETURN_FLOAT8((float8) key->lower - (float8) query);
+	if(query > key->upper)
+		PG_RETURN_FLOAT8((float8) query - (float8) key->upper);
+	PG_RETURN_FLOAT8(0);
+}
@@ -0,0 +1,212 @@
+/*
+ * timestampandtz8, the same value packed into one int64 and passed by value:
+ * the utc time in the top 54 bits and the zone id in the low 10.  That covers
+ * about 285 years either side of 2000 at full microsecond precision, the two
+ * extremes of the time field stand for -infinity and infinity.
+ */
+#define TIMESTAMPANDTZ8_TZ_BITS 10
+#define TIMESTAMPANDTZ8_TZ_MASK ((INT64CONST(1) << TIMESTAMPANDTZ8_TZ_BITS) - 1)
+#define TIMESTAMPANDTZ8_NOBEGIN (-(INT64CONST(1) << (63 - TIMESTAMPANDTZ8_TZ_BITS)))
+#define TIMESTAMPANDTZ8_NOEND ((INT64CONST(1) << (63 - TIMESTAMPANDTZ8_TZ_BITS)) - 1)
+
+/* utc time field, arithmetic shift keeps the sign */
+#define TIMESTAMPANDTZ8_TIME(v) ((v) >> TIMESTAMPANDTZ8_TZ_BITS)
+
+/* false (with the error in escontext) if the time or the zone id doesn't fit */
+static bool timestampandtz8_pack(TimestampAndTz *dt, int64 *result, Node *escontext)
+{
+	int64 time;
+	int tz = dt->tz;
+
+	StaticAssertStmt(NTIMEZONES <= TIMESTAMPANDTZ8_TZ_MASK, "zone ids must fit in the low bits of timestampandtz8");
+
+	if(tz < 1 || tz > (int) NTIMEZONES)
+		ereturn(escontext, false,
+				(errcode(ERRCODE_DATA_CORRUPTED),
+				 errmsg("invalid timezone ID %d in timestampandtz", tz)));
+
+	if(TIMESTAMP_IS_NOBEGIN(dt->time))
+		time = TIMESTAMPANDTZ8_NOBEGIN;
+	else if(TIMESTAMP_IS_NOEND(dt->time))
+		time = TIMESTAMPANDTZ8_NOEND;
+	else if(dt->time <= TIMESTAMPANDTZ8_NOBEGIN || dt->time >= TIMESTAMPANDTZ8_NOEND)
+		ereturn(escontext, false,
+				(errcode(ERRCODE_DATETIME_VALUE_OUT_OF_RANGE),
+				 errmsg("timestamp out of range for timestampandtz8")));
+	else
+		time = dt->time;
+
+	*result = (int64) (((uint64) time << TIMESTAMPANDTZ8_TZ_BITS) | (uint64) tz);
+	return true;
+}
+
+static void timestampandtz8_unpack(int64 v, TimestampAndTz *dt)
+{
+	int64 time = TIMESTAMPANDTZ8_TIME(v);
+
+	memset(dt, 0, sizeof(TimestampAndTz));
+	if(time == TIMESTAMPANDTZ8_NOBEGIN)
+		TIMESTAMP_NOBEGIN(dt->time);
+	else if(time == TIMESTAMPANDTZ8_NOEND)
+		TIMESTAMP_NOEND(dt->time);
+	else
+		dt->time = time;
+	dt->tz = (short) (v & TIMESTAMPANDTZ8_TZ_MASK);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz8_in);
+Datum timestampandtz8_in(PG_FUNCTION_ARGS)
+{
+	Node *escontext = fcinfo->context;
+	Datum dt;
+	int64 result;
+
+#if PG_VERSION_NUM >= 160000
+	if(!DirectInputFunctionCallSafe(timestampandtz_in, PG_GETARG_CSTRING(0),
+			PG_GETARG_OID(1), PG_GETARG_INT32(2), escontext, &dt))
+		PG_RETURN_NULL();
+#else
+	dt = DirectFunctionCall3(timestampandtz_in, PG_GETARG_DATUM(0), PG_GETARG_DATUM(1), PG_GETARG_DATUM(2));
+#endif
+	if(!timestampandtz8_pack((TimestampAndTz *) DatumGetPointer(dt), &result, escontext))
+		PG_RETURN_NULL();
+	PG_RETURN_INT64(result);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz8_out);
+Datum timestampandtz8_out(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz dt;
+
+	timestampandtz8_unpack(PG_GETARG_INT64(0), &dt);
+	return DirectFunctionCall1(timestampandtz_out, PointerGetDatum(&dt));
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz8_recv);
+Datum timestampandtz8_recv(PG_FUNCTION_ARGS)
+{
+	Datum dt = DirectFunctionCall3(timestampandtz_recv, PG_GETARG_DATUM(0), PG_GETARG_DATUM(1), PG_GETARG_DATUM(2));
+	int64 result;
+
+	timestampandtz8_pack((TimestampAndTz *) DatumGetPointer(dt), &result, NULL);
+	PG_RETURN_INT64(result);
+}
+
+/* the wire format is the same as timestampandtz */
+PG_FUNCTION_INFO_V1(timestampandtz8_send);
+Datum timestampandtz8_send(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz dt;
+
+	timestampandtz8_unpack(PG_GETARG_INT64(0), &dt);
+	return DirectFunctionCall1(timestampandtz_send, PointerGetDatum(&dt));
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_to_timestampandtz8);
+Datum timestampandtz_to_timestampandtz8(PG_FUNCTION_ARGS)
+{
+	int64 result;
+
+	timestampandtz8_pack((TimestampAndTz *)PG_GETARG_POINTER(0), &result, NULL);
+	PG_RETURN_INT64(result);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz8_to_timestampandtz);
+Datum timestampandtz8_to_timestampandtz(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *result = (TimestampAndTz *) palloc(sizeof(TimestampAndTz));
+
+	timestampandtz8_unpack(PG_GETARG_INT64(0), result);
+	PG_RETURN_POINTER(result);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz8_to_timestamptz);
+Datum timestampandtz8_to_timestamptz(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz dt;
+
+	timestampandtz8_unpack(PG_GETARG_INT64(0), &dt);
+	PG_RETURN_TIMESTAMPTZ(dt.time);
+}
+
+/* like timestampandtz, equality and order only look at the utc time */
+static int timestampandtz8_cmp_internal(int64 left, int64 right)
+{
+	left = TIMESTAMPANDTZ8_TIME(left);
+	right = TIMESTAMPANDTZ8_TIME(right);
+
+	if(left > right)
+		return 1;
+	else if(left < right)
+		return -1;
+	else
+		return 0;
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz8_eq);
+Datum timestampandtz8_eq(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(timestampandtz8_cmp_internal(PG_GETARG_INT64(0), PG_GETARG_INT64(1)) == 0);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz8_ne);
+Datum timestampandtz8_ne(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(timestampandtz8_cmp_internal(PG_GETARG_INT64(0), PG_GETARG_INT64(1)) != 0);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz8_lt);
+Datum timestampandtz8_lt(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(timestampandtz8_cmp_internal(PG_GETARG_INT64(0), PG_GETARG_INT64(1)) < 0);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz8_le);
+Datum timestampandtz8_le(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(timestampandtz8_cmp_internal(PG_GETARG_INT64(0), PG_GETARG_INT64(1)) <= 0);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz8_gt);
+Datum timestampandtz8_gt(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(timestampandtz8_cmp_internal(PG_GETARG_INT64(0), PG_GETARG_INT64(1)) > 0);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz8_ge);
+Datum timestampandtz8_ge(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_BOOL(timestampandtz8_cmp_internal(PG_GETARG_INT64(0), PG_GETARG_INT64(1)) >= 0);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz8_cmp);
+Datum timestampandtz8_cmp(PG_FUNCTION_ARGS)
+{
+	PG_RETURN_INT32(timestampandtz8_cmp_internal(PG_GETARG_INT64(0), PG_GETARG_INT64(1)));
+}
+
+static int timestampandtz8_fastcmp(Datum x, Datum y, SortSupport ssup)
+{
+	return timestampandtz8_cmp_internal(DatumGetInt64(x), DatumGetInt64(y));
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz8_sortsupport);
+Datum timestampandtz8_sortsupport(PG_FUNCTION_ARGS)
+{
+	SortSupport ssup = (SortSupport) PG_GETARG_POINTER(0);
+
+	ssup->comparator = timestampandtz8_fastcmp;
+	PG_RETURN_VOID();
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz8_hash);
+Datum timestampandtz8_hash(PG_FUNCTION_ARGS)
+{
+	return DirectFunctionCall1(hashint8, Int64GetDatum(TIMESTAMPANDTZ8_TIME(PG_GETARG_INT64(0))));
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz8_hash_extended);
+Datum timestampandtz8_hash_extended(PG_FUNCTION_ARGS)
+{
+	return DirectFunctionCall2(hashint8extended, Int64GetDatum(TIMESTAMPANDTZ8_TIME(PG_GETARG_INT64(0))), PG_GETARG_DATUM(1));
+}
@@ -1,6 +1,17 @@
+/*
+ * Generates zones.c: the timezone list sorted by name (with the length of each
+ * name), the id -> zone map and a perfect hash over the upper-cased zone names
+ * for tzname_to_tzid.
+ *
+ *    cc -o sorter sorter.c && ./sorter > zones.c
+ *
+ * New zones must be appended to the end of the list below with the next id,
+ * ids are stored on disk and can never change.
+ */
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
 
 struct timezone_to_id {
 	const char *name;
@@ -606,6 +617,44 @@ static struct timezone_to_id timezones[] = {
 	{ "posixrules", "POSIXRULES", 594},
 };
 
+#define NTIMEZONES (sizeof(timezones)/sizeof(timezones[0]))
+
+/* perfect hash layout, see tzname_hash() in timestampandtz.c which must match */
+#define TZHASH_BUCKET_BITS 8
+#define TZHASH_SIZE_BITS 10
+#define TZHASH_BUCKETS (1 << TZHASH_BUCKET_BITS)
+#define TZHASH_SIZE (1 << TZHASH_SIZE_BITS)
+
+static uint32_t tzname_hash(uint32_t seed, const char *name)
+{
+	uint32_t h = seed;
+
+	for(; *name; name++)
+	{
+		unsigned char ch = (unsigned char) *name;
+
+		if(ch >= 'a' && ch <= 'z')
+			ch += 'A' - 'a';
+		h = (h ^ ch) * 16777619;
+	}
+
+	h ^= h >> 16;
+	h *= 0x85ebca6b;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35;
+	h ^= h >> 16;
+	return h;
+}
+
+#define TZHASH_BUCKET(h) ((h) >> (32 - TZHASH_BUCKET_BITS))
+#define TZHASH_SLOT(h, d) (((h) ^ (d)) & (TZHASH_SIZE - 1))
+
+static uint32_t hashes[NTIMEZONES];
+static int bucket_order[TZHASH_BUCKETS];
+static int bucket_size[TZHASH_BUCKETS];
+static unsigned short displacements[TZHASH_BUCKETS];
+static unsigned short slots[TZHASH_SIZE];
+
 int string_compare(const void *a, const void *b)
 {
 	const char **sa = (const char **)a;
@@ -613,36 +662,128 @@ int string_compare(const void *a, const void *b)
 	return strcmp(*sa, *sb);
 }
 
+int bucket_compare(const void *a, const void *b)
+{
+	return bucket_size[*(const int *)b] - bucket_size[*(const int *)a];
+}
+
+/*
+ * Hash and displace: every zone hashes to a bucket, and each bucket gets the
+ * smallest displacement that moves all of its zones into free slots.
+ */
+static int build_hash(uint32_t seed)
+{
+	memset(bucket_size, 0, sizeof(bucket_size));
+	memset(displacements, 0, sizeof(displacements));
+	memset(slots, 0, sizeof(slots));
+
+	for(int i = 0; i < NTIMEZONES; i++)
+	{
+		hashes[i] = tzname_hash(seed, timezones[i].nameupper);
+		bucket_size[TZHASH_BUCKET(hashes[i])]++;
+	}
+
+	for(int b = 0; b < TZHASH_BUCKETS; b++)
+		bucket_order[b] = b;
+	qsort(bucket_order, TZHASH_BUCKETS, sizeof(int), bucket_compare);
+
+	for(int b = 0; b < TZHASH_BUCKETS && bucket_size[bucket_order[b]] > 0; b++)
+	{
+		int bucket = bucket_order[b];
+		int d;
+
+		for(d = 0; d < TZHASH_SIZE; d++)
+		{
+			int ok = 1;
+
+			for(int i = 0; i < NTIMEZONES && ok; i++)
+			{
+				if(TZHASH_BUCKET(hashes[i]) != bucket)
+					continue;
+				if(slots[TZHASH_SLOT(hashes[i], d)] != 0)
+					ok = 0;
+				/* two zones of the same bucket can land on the same slot */
+				for(int j = 0; j < i && ok; j++)
+					if(TZHASH_BUCKET(hashes[j]) == bucket &&
+						TZHASH_SLOT(hashes[j], d) == TZHASH_SLOT(hashes[i], d))
+						ok = 0;
+			}
+
+			if(ok)
+				break;
+		}
+
+		if(d == TZHASH_SIZE)
+			return 0;
+
+		displacements[bucket] = d;
+		for(int i = 0; i < NTIMEZONES; i++)
+			if(TZHASH_BUCKET(hashes[i]) == bucket)
+				slots[TZHASH_SLOT(hashes[i], d)] = timezones[i].id;
+	}
+
+	return 1;
+}
+
 int main(void)
 {
-	int zone_to_id[594];
-	const char *zone_names[594] = { 0 };
-	for(int i = 0; i < 594; i++)
+	int zone_to_id[NTIMEZONES];
+	const char *zone_names[NTIMEZONES] = { 0 };
+	uint32_t seed;
+
+	for(int i = 0; i < NTIMEZONES; i++)
 		zone_names[i] = timezones[i].nameupper;
 
-	qsort(zone_names, 594, sizeof(const char *), string_compare);
+	qsort(zone_names, NTIMEZONES, sizeof(const char *), string_compare);
+
+	for(seed = 2166136261u; !build_hash(seed); seed++)
+		;
+
+	printf("/* generated by sorter.c, do not edit */\n\n");
+	printf("struct timezone_to_id {\n");
+	printf("\tconst char *name;\n");
+	printf("\tconst char *nameupper;\n");
+	printf("\tint id;\n");
+	printf("\tint namelen;\n");
+	printf("};\n\n");
 
 	printf("static struct timezone_to_id timezones[] = {\n");
-	for(int i = 0; i < 594; i++)
+	for(int i = 0; i < NTIMEZONES; i++)
 	{
 		//find the entry in sort order
-		for(int j = 0; j < 594; j++)
+		for(int j = 0; j < NTIMEZONES; j++)
 		{
 			if(strcmp(timezones[j].nameupper, zone_names[i]) == 0)
 			{
-				printf("\t{ \"%s\", \"%s\", %d },\n", timezones[j].name, timezones[j].nameupper, timezones[j].id);
+				printf("\t{ \"%s\", \"%s\", %d, %d },\n", timezones[j].name, timezones[j].nameupper, timezones[j].id, (int) strlen(timezones[j].name));
 				zone_to_id[j] = i;
 				break;
 			}
 		}
 	}
-	printf("};\n");
+	printf("};\n\n");
 
 	printf("static const struct timezone_to_id *timezones_by_id[] = {\n");
-	for(int i = 0; i < 594; i++)
+	for(int i = 0; i < NTIMEZONES; i++)
 	{
 		printf("\t&timezones[%d],\n", zone_to_id[i]);
 	}
+	printf("};\n\n");
+
+	printf("#define NTIMEZONES (sizeof(timezones)/sizeof(timezones[0]))\n\n");
+
+	printf("#define TZHASH_SEED %uu\n", seed);
+	printf("#define TZHASH_BUCKET_BITS %d\n", TZHASH_BUCKET_BITS);
+	printf("#define TZHASH_SIZE %d\n\n", TZHASH_SIZE);
+
+	printf("static const uint16 tzhash_displacements[%d] = {\n", TZHASH_BUCKETS);
+	for(int i = 0; i < TZHASH_BUCKETS; i++)
+		printf("%s%d,%s", i % 16 == 0 ? "\t" : " ", displacements[i], i % 16 == 15 ? "\n" : "");
+	printf("};\n\n");
+
+	printf("static const uint16 tzhash_ids[%d] = {\n", TZHASH_SIZE);
+	for(int i = 0; i < TZHASH_SIZE; i++)
+		printf("%s%d,%s", i % 16 == 0 ? "\t" : " ", slots[i], i % 16 == 15 ? "\n" : "");
 	printf("};\n");
 
 	return 0;
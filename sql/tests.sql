@@ -104,3 +104,109 @@ select '8/15/2014 9:15pm @ US/Pacific'::timestampandtz::date='8/15/2014'::date;
 
 select to_char('8/15/2014 9:15pm @ US/Eastern'::timestampandtz, 'HH24:MI YYYY-MM-DD');
 select to_char('8/15/2014 9:15pm @ US/Pacific'::timestampandtz, 'HH24:MI YYYY-MM-DD');
+
+select timestampandtz_hash('9-18-2014 8:15pm @ US/Eastern') = timestampandtz_hash('9-18-2014 5:15pm @ US/Pacific');
+select count(*) from (select distinct dt from times) s;
+
+select '8/15/2014'::date='8/15/2014 @ US/Pacific'::timestampandtz;
+select '8/16/2014'::date>'8/15/2014 9:15pm @ US/Pacific'::timestampandtz;
+
+select '9-18-2014 5:15pm @ US/Pacific'::timestampandtz='9-18-2014 8:15pm'::timestamptz;
+select count(*) from times where dt >= '9-18-2014 20:17'::timestamptz;
+
+select max(dt), min(dt) from times;
+
+create index ix_times_dt_brin on times using brin (dt);
+set enable_seqscan = off;
+set enable_indexscan = off;
+select count(*) from times where dt >= '9-18-2014 5:17pm @ US/Pacific'::timestampandtz;
+select count(*) from times where dt < '9-18-2014 20:17'::timestamptz;
+reset enable_indexscan;
+reset enable_seqscan;
+
+create table shifts (during timestampandtzrange, exclude using gist (during with &&));
+insert into shifts values (timestampandtzrange('9-18-2014 8:00pm @ US/Eastern', '9-18-2014 9:00pm @ US/Eastern'));
+insert into shifts values (timestampandtzrange('9-18-2014 6:00pm @ US/Pacific', '9-18-2014 7:00pm @ US/Pacific'));
+insert into shifts values (timestampandtzrange('9-18-2014 5:30pm @ US/Pacific', '9-18-2014 5:45pm @ US/Pacific'));
+select count(*) from shifts where during @> '9-18-2014 9:30pm @ US/Eastern'::timestampandtz;
+select timestampandtzrange('9-18-2014 8:00pm @ US/Eastern', '9-18-2014 9:00pm @ US/Eastern') && timestampandtzrange('9-18-2014 5:59pm @ US/Pacific', '9-18-2014 7:00pm @ US/Pacific');
+
+select '9-18-2014 8:15pm @ US/Eastern'::timestampandtz <-> '9-18-2014 5:00pm @ US/Pacific'::timestampandtz;
+create index ix_times_dt_gist on times using gist (dt);
+set enable_seqscan = off;
+select dt from times order by dt <-> '9-18-2014 5:17:40pm @ US/Pacific'::timestampandtz limit 2;
+reset enable_seqscan;
+
+create index ix_times_dt_gin on times using gin (dt);
+create table events (id int, at timestampandtz[]);
+create index ix_events_at on events using gin (at);
+insert into events values (1, array['9-18-2014 8:15pm @ US/Eastern', '9-19-2014 8:15pm @ US/Eastern']::timestampandtz[]);
+insert into events values (2, array['9-18-2014 5:30pm @ US/Pacific']::timestampandtz[]);
+set enable_seqscan = off;
+set enable_indexscan = off;
+select count(*) from times where dt > '9-18-2014 5:17pm @ US/Pacific'::timestampandtz and dt <= '9-18-2014 20:19'::timestampandtz;
+select id from events where at @> array['9-18-2014 5:15pm @ US/Pacific'::timestampandtz];
+select id from events where at && array['9-18-2014 8:30pm'::timestampandtz, '9-19-2014 8:15pm'::timestampandtz] order by id;
+reset enable_indexscan;
+reset enable_seqscan;
+
+select dt, count(*) over (order by dt range between interval '1 minute' preceding and current row) from times;
+
+create index ix_times_dt_local on times (dt timestampandtz_local_ops);
+set enable_seqscan = off;
+select count(*) from times where dt >= '9-18-2014'::date and dt < '9-19-2014'::date;
+select dt from times order by dt using ~<~;
+select count(*) from times where dt ~=~ '9-18-2014 5:16pm @ US/Pacific' and dt >= '9-18-2014'::date;
+reset enable_seqscan;
+select '9-18-2014 8:15pm @ US/Eastern'::timestampandtz ~=~ '9-18-2014 8:15pm @ US/Pacific'::timestampandtz, '9-18-2014 8:15pm @ US/Eastern'::timestampandtz ~<>~ '9-18-2014 8:15pm @ US/Pacific'::timestampandtz, '9-18-2014 8:15pm @ US/Eastern'::timestampandtz = '9-18-2014 8:15pm @ US/Pacific'::timestampandtz;
+
+select '9-18-2014 8:15pm @ US/Eastern'::timestampandtz *= '9-18-2014 5:15pm @ US/Pacific'::timestampandtz, '9-18-2014 8:15pm @ US/Eastern'::timestampandtz *< '9-18-2014 5:15pm @ US/Pacific'::timestampandtz;
+create index ix_times_dt_image on times (dt timestampandtz_image_ops);
+set enable_seqscan = off;
+select count(*) from times where dt *= '9-18-2014 5:16pm @ US/Pacific'::timestampandtz;
+reset enable_seqscan;
+
+select '9-18-2014 5:16pm @ US/Pacific'::timestampandtz8;
+select pg_column_size('9-18-2014 5:16pm @ US/Pacific'::timestampandtz8);
+create table times8 as select dt::timestampandtz8 as dt from times;
+create index ix_times8_dt on times8 (dt);
+select count(*) from times8 where dt = '9-18-2014 8:16pm @ US/Eastern' and dt = '9-18-2014 8:16pm'::timestampandtz;
+select min(dt::timestampandtz), max(dt::timestampandtz) from times8;
+select v::timestampandtz8 as packed, v::timestampandtz8::timestampandtz as unpacked from (values ('infinity @ UTC'), ('-infinity @ US/Eastern')) t(v);
+
+select typlen, typalign from pg_type where typname = 'timestampandtz';
+
+select '2014-09-18T20:15:00.5 @ US/Pacific'::timestampandtz;
+select '2014-09-18 20:15 @ us/pacific'::timestampandtz = '9-18-2014 8:15pm @ US/Pacific'::timestampandtz;
+
+select '2014-09-01T22:15:00-04:00[US/Eastern]'::timestampandtz;
+select '2014-11-02T01:30:00-05:00[US/Eastern]'::timestampandtz - '2014-11-02T01:30:00-04:00[US/Eastern]'::timestampandtz;
+select '9/1/2014 10:15pm -04:00 @ US/Pacific'::timestampandtz;
+set timestampandtz.check_offsets = on;
+select v::timestampandtz from (values ('2014-09-01T22:15:00-05:00[US/Eastern]')) t(v);
+select v::timestampandtz from (values ('2014-09-01T22:15:00-04:00[US/Eastern]')) t(v);
+reset timestampandtz.check_offsets;
+
+do $$
+declare
+	valid bool[];
+	message text;
+begin
+	-- soft errors need 16, older servers have nothing to check
+	if current_setting('server_version_num')::int >= 160000 then
+		execute $q$select array[pg_input_is_valid('2014-09-18 20:15 @ US/Eastern', 'timestampandtz'), pg_input_is_valid('2014-09-18 20:15 @ foobar', 'timestampandtz'), pg_input_is_valid('9-18-2014 8:75pm @ US/Eastern', 'timestampandtz'), pg_input_is_valid('2400-01-01 00:00 @ US/Eastern', 'timestampandtz8')]$q$ into valid;
+		assert valid = array[true, false, false, false], valid::text;
+		execute $q$select message from pg_input_error_info('2014-09-18 20:15 @ foobar', 'timestampandtz')$q$ into message;
+		assert message = 'missing timezone ID "foobar" while parsing timestampandtz "2014-09-18 20:15"', message;
+	end if;
+end $$;
+
+set datestyle = iso;
+select v::timestampandtz from (values ('2014-09-18 20:15 @ US/Pacific'), ('2014-09-18 20:15:00.25 @ Asia/Kolkata'), ('2014-11-02T01:30:00-05:00[US/Eastern]'), ('2250-07-01 12:00 @ Europe/London'), ('0044-03-15 12:00 BC @ UTC'), ('infinity @ UTC')) t(v);
+reset datestyle;
+
+select f, to_char('2014-09-18 20:15 @ US/Eastern'::timestampandtz, f) from (values ('YYYY-MM-DD'), ('HH24:MI'), ('YYYY-MM-DD'), ('Dy DD Mon')) t(f);
+select count(distinct to_char(dt, repeat('HH24:MI ', 20))), min(length(to_char(dt, repeat('HH24:MI ', 20)))) from times;
+
+select v::timestampandtz from (values ('2014-09-18 20:15:00.123457Z @ US/Pacific'), ('2014-09-18 20:15:00.1234567Z @ US/Pacific'), ('2014-09-18 20:15:00.1234567 EDT @ US/Pacific')) t(v);
+select v, count(*) over (order by v range between interval '1 day' preceding and current row) from (values ('2014-11-02 00:30 @ US/Eastern'::timestampandtz), ('2014-11-02 00:45 @ US/Central'), ('2014-11-01 23:00 @ US/Pacific'), ('2014-11-03 00:40 @ US/Eastern')) t(v);
@@ -0,0 +1,369 @@
+create function timestampandtz_hash(timestampandtz) returns int4 as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_hash_extended(timestampandtz, int8) returns int8 as 'timestampandtz.so' language C immutable strict parallel safe;
+create operator class timestampandtz_hash_ops default for type timestampandtz using hash as
+	operator 1 =,
+	function 1 timestampandtz_hash( timestampandtz ),
+	function 2 timestampandtz_hash_extended( timestampandtz, int8 );
+create function timestampandtz_sortsupport(internal) returns void as 'timestampandtz.so' language C immutable strict parallel safe;
+alter operator family timestampandtz_ops using btree add
+	function 2 ( timestampandtz, timestampandtz ) timestampandtz_sortsupport( internal );
+
+alter operator = (timestampandtz, timestampandtz) set ( restrict = eqsel, join = eqjoinsel );
+alter operator <> (timestampandtz, timestampandtz) set ( restrict = neqsel, join = neqjoinsel );
+alter operator < (timestampandtz, timestampandtz) set ( restrict = scalarltsel, join = scalarltjoinsel );
+alter operator <= (timestampandtz, timestampandtz) set ( restrict = scalarlesel, join = scalarlejoinsel );
+alter operator > (timestampandtz, timestampandtz) set ( restrict = scalargtsel, join = scalargtjoinsel );
+alter operator >= (timestampandtz, timestampandtz) set ( restrict = scalargesel, join = scalargejoinsel );
+alter operator = (timestampandtz, date) set ( restrict = eqsel, join = eqjoinsel );
+alter operator <> (timestampandtz, date) set ( restrict = neqsel, join = neqjoinsel );
+alter operator < (timestampandtz, date) set ( restrict = scalarltsel, join = scalarltjoinsel );
+alter operator <= (timestampandtz, date) set ( restrict = scalarlesel, join = scalarlejoinsel );
+alter operator > (timestampandtz, date) set ( restrict = scalargtsel, join = scalargtjoinsel );
+alter operator >= (timestampandtz, date) set ( restrict = scalargesel, join = scalargejoinsel );
+
+create function date_eq_timestampandtz(date, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function date_ne_timestampandtz(date, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function date_lt_timestampandtz(date, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function date_le_timestampandtz(date, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function date_gt_timestampandtz(date, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function date_ge_timestampandtz(date, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create operator = ( leftarg = date, rightarg = timestampandtz, procedure = date_eq_timestampandtz, commutator = operator(=), negator = operator(<>), restrict = eqsel, join = eqjoinsel );
+create operator <> ( leftarg = date, rightarg = timestampandtz, procedure = date_ne_timestampandtz, commutator = operator(<>), negator = operator(=), restrict = neqsel, join = neqjoinsel );
+create operator < ( leftarg = date, rightarg = timestampandtz, procedure = date_lt_timestampandtz, commutator = operator(>), negator = operator(>=), restrict = scalarltsel, join = scalarltjoinsel );
+create operator <= ( leftarg = date, rightarg = timestampandtz, procedure = date_le_timestampandtz, commutator = operator(>=), negator = operator(>), restrict = scalarlesel, join = scalarlejoinsel );
+create operator > ( leftarg = date, rightarg = timestampandtz, procedure = date_gt_timestampandtz, commutator = operator(<), negator = operator(<=), restrict = scalargtsel, join = scalargtjoinsel );
+create operator >= ( leftarg = date, rightarg = timestampandtz, procedure = date_ge_timestampandtz, commutator = operator(<=), negator = operator(<), restrict = scalargesel, join = scalargejoinsel );
+
+-- alter operator can only set commutators, negators, hashes and merges from PostgreSQL 17 on,
+-- before that they are set in the catalog, none of them are recorded in pg_depend
+do $$
+begin
+	if current_setting('server_version_num')::int >= 170000 then
+		alter operator = ( timestampandtz, timestampandtz ) set ( commutator = operator(=), negator = operator(<>), hashes, merges );
+		alter operator <> ( timestampandtz, timestampandtz ) set ( commutator = operator(<>), negator = operator(=) );
+		alter operator < ( timestampandtz, timestampandtz ) set ( commutator = operator(>), negator = operator(>=) );
+		alter operator <= ( timestampandtz, timestampandtz ) set ( commutator = operator(>=), negator = operator(>) );
+		alter operator > ( timestampandtz, timestampandtz ) set ( commutator = operator(<), negator = operator(<=) );
+		alter operator >= ( timestampandtz, timestampandtz ) set ( commutator = operator(<=), negator = operator(<) );
+		alter operator = ( timestampandtz, date ) set ( commutator = operator(=), negator = operator(<>) );
+		alter operator <> ( timestampandtz, date ) set ( commutator = operator(<>), negator = operator(=) );
+		alter operator < ( timestampandtz, date ) set ( commutator = operator(>), negator = operator(>=) );
+		alter operator <= ( timestampandtz, date ) set ( commutator = operator(>=), negator = operator(>) );
+		alter operator > ( timestampandtz, date ) set ( commutator = operator(<), negator = operator(<=) );
+		alter operator >= ( timestampandtz, date ) set ( commutator = operator(<=), negator = operator(<) );
+	else
+		update pg_catalog.pg_operator set oprcom = '=(timestampandtz, timestampandtz)'::pg_catalog.regoperator, oprnegate = '<>(timestampandtz, timestampandtz)'::pg_catalog.regoperator, oprcanhash = true, oprcanmerge = true
+			where oid = '=(timestampandtz, timestampandtz)'::pg_catalog.regoperator;
+		update pg_catalog.pg_operator set oprcom = '<>(timestampandtz, timestampandtz)'::pg_catalog.regoperator, oprnegate = '=(timestampandtz, timestampandtz)'::pg_catalog.regoperator
+			where oid = '<>(timestampandtz, timestampandtz)'::pg_catalog.regoperator;
+		update pg_catalog.pg_operator set oprcom = '>(timestampandtz, timestampandtz)'::pg_catalog.regoperator, oprnegate = '>=(timestampandtz, timestampandtz)'::pg_catalog.regoperator
+			where oid = '<(timestampandtz, timestampandtz)'::pg_catalog.regoperator;
+		update pg_catalog.pg_operator set oprcom = '>=(timestampandtz, timestampandtz)'::pg_catalog.regoperator, oprnegate = '>(timestampandtz, timestampandtz)'::pg_catalog.regoperator
+			where oid = '<=(timestampandtz, timestampandtz)'::pg_catalog.regoperator;
+		update pg_catalog.pg_operator set oprcom = '<(timestampandtz, timestampandtz)'::pg_catalog.regoperator, oprnegate = '<=(timestampandtz, timestampandtz)'::pg_catalog.regoperator
+			where oid = '>(timestampandtz, timestampandtz)'::pg_catalog.regoperator;
+		update pg_catalog.pg_operator set oprcom = '<=(timestampandtz, timestampandtz)'::pg_catalog.regoperator, oprnegate = '<(timestampandtz, timestampandtz)'::pg_catalog.regoperator
+			where oid = '>=(timestampandtz, timestampandtz)'::pg_catalog.regoperator;
+		update pg_catalog.pg_operator set oprcom = '=(date, timestampandtz)'::pg_catalog.regoperator, oprnegate = '<>(timestampandtz, date)'::pg_catalog.regoperator
+			where oid = '=(timestampandtz, date)'::pg_catalog.regoperator;
+		update pg_catalog.pg_operator set oprcom = '<>(date, timestampandtz)'::pg_catalog.regoperator, oprnegate = '=(timestampandtz, date)'::pg_catalog.regoperator
+			where oid = '<>(timestampandtz, date)'::pg_catalog.regoperator;
+		update pg_catalog.pg_operator set oprcom = '>(date, timestampandtz)'::pg_catalog.regoperator, oprnegate = '>=(timestampandtz, date)'::pg_catalog.regoperator
+			where oid = '<(timestampandtz, date)'::pg_catalog.regoperator;
+		update pg_catalog.pg_operator set oprcom = '>=(date, timestampandtz)'::pg_catalog.regoperator, oprnegate = '>(timestampandtz, date)'::pg_catalog.regoperator
+			where oid = '<=(timestampandtz, date)'::pg_catalog.regoperator;
+		update pg_catalog.pg_operator set oprcom = '<(date, timestampandtz)'::pg_catalog.regoperator, oprnegate = '<=(timestampandtz, date)'::pg_catalog.regoperator
+			where oid = '>(timestampandtz, date)'::pg_catalog.regoperator;
+		update pg_catalog.pg_operator set oprcom = '<=(date, timestampandtz)'::pg_catalog.regoperator, oprnegate = '<(timestampandtz, date)'::pg_catalog.regoperator
+			where oid = '>=(timestampandtz, date)'::pg_catalog.regoperator;
+	end if;
+end
+$$;
+
+create function timestampandtz_eq_timestamptz(timestampandtz, timestamptz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_ne_timestamptz(timestampandtz, timestamptz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_lt_timestamptz(timestampandtz, timestamptz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_le_timestamptz(timestampandtz, timestamptz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_gt_timestamptz(timestampandtz, timestamptz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_ge_timestamptz(timestampandtz, timestamptz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_cmp_timestamptz(timestampandtz, timestamptz) returns int4 as 'timestampandtz.so' language C immutable strict parallel safe;
+create operator = ( leftarg = timestampandtz, rightarg = timestamptz, procedure = timestampandtz_eq_timestamptz, commutator = operator(=), negator = operator(<>), restrict = eqsel, join = eqjoinsel, merges );
+create operator <> ( leftarg = timestampandtz, rightarg = timestamptz, procedure = timestampandtz_ne_timestamptz, commutator = operator(<>), negator = operator(=), restrict = neqsel, join = neqjoinsel );
+create operator < ( leftarg = timestampandtz, rightarg = timestamptz, procedure = timestampandtz_lt_timestamptz, commutator = operator(>), negator = operator(>=), restrict = scalarltsel, join = scalarltjoinsel );
+create operator <= ( leftarg = timestampandtz, rightarg = timestamptz, procedure = timestampandtz_le_timestamptz, commutator = operator(>=), negator = operator(>), restrict = scalarlesel, join = scalarlejoinsel );
+create operator > ( leftarg = timestampandtz, rightarg = timestamptz, procedure = timestampandtz_gt_timestamptz, commutator = operator(<), negator = operator(<=), restrict = scalargtsel, join = scalargtjoinsel );
+create operator >= ( leftarg = timestampandtz, rightarg = timestamptz, procedure = timestampandtz_ge_timestamptz, commutator = operator(<=), negator = operator(<), restrict = scalargesel, join = scalargejoinsel );
+
+create function timestamptz_eq_timestampandtz(timestamptz, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestamptz_ne_timestampandtz(timestamptz, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestamptz_lt_timestampandtz(timestamptz, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestamptz_le_timestampandtz(timestamptz, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestamptz_gt_timestampandtz(timestamptz, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestamptz_ge_timestampandtz(timestamptz, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestamptz_cmp_timestampandtz(timestamptz, timestampandtz) returns int4 as 'timestampandtz.so' language C immutable strict parallel safe;
+create operator = ( leftarg = timestamptz, rightarg = timestampandtz, procedure = timestamptz_eq_timestampandtz, commutator = operator(=), negator = operator(<>), restrict = eqsel, join = eqjoinsel, merges );
+create operator <> ( leftarg = timestamptz, rightarg = timestampandtz, procedure = timestamptz_ne_timestampandtz, commutator = operator(<>), negator = operator(=), restrict = neqsel, join = neqjoinsel );
+create operator < ( leftarg = timestamptz, rightarg = timestampandtz, procedure = timestamptz_lt_timestampandtz, commutator = operator(>), negator = operator(>=), restrict = scalarltsel, join = scalarltjoinsel );
+create operator <= ( leftarg = timestamptz, rightarg = timestampandtz, procedure = timestamptz_le_timestampandtz, commutator = operator(>=), negator = operator(>), restrict = scalarlesel, join = scalarlejoinsel );
+create operator > ( leftarg = timestamptz, rightarg = timestampandtz, procedure = timestamptz_gt_timestampandtz, commutator = operator(<), negator = operator(<=), restrict = scalargtsel, join = scalargtjoinsel );
+create operator >= ( leftarg = timestamptz, rightarg = timestampandtz, procedure = timestamptz_ge_timestampandtz, commutator = operator(<=), negator = operator(<), restrict = scalargesel, join = scalargejoinsel );
+
+-- comparisons against timestamptz are plain utc comparisons, so they share the btree family
+alter operator family timestampandtz_ops using btree add
+	operator 1 < ( timestampandtz, timestamptz ), operator 2 <= ( timestampandtz, timestamptz ), operator 3 = ( timestampandtz, timestamptz ),
+	operator 4 >= ( timestampandtz, timestamptz ), operator 5 > ( timestampandtz, timestamptz ),
+	function 1 ( timestampandtz, timestamptz ) timestampandtz_cmp_timestamptz( timestampandtz, timestamptz ),
+	operator 1 < ( timestamptz, timestampandtz ), operator 2 <= ( timestamptz, timestampandtz ), operator 3 = ( timestamptz, timestampandtz ),
+	operator 4 >= ( timestamptz, timestampandtz ), operator 5 > ( timestamptz, timestampandtz ),
+	function 1 ( timestamptz, timestampandtz ) timestamptz_cmp_timestampandtz( timestamptz, timestampandtz ),
+	operator 1 < ( timestamptz, timestamptz ), operator 2 <= ( timestamptz, timestamptz ), operator 3 = ( timestamptz, timestamptz ),
+	operator 4 >= ( timestamptz, timestamptz ), operator 5 > ( timestamptz, timestamptz ),
+	function 1 ( timestamptz, timestamptz ) timestamptz_cmp( timestamptz, timestamptz );
+
+alter function timestampandtz_in(cstring, oid, integer) parallel safe;
+alter function timestampandtz_out(timestampandtz) parallel safe;
+alter function timestampandtz_recv(internal, oid, integer) parallel safe;
+alter function timestampandtz_send(timestampandtz) parallel safe;
+alter function timestampandtz_typmodin(cstring[]) parallel safe;
+alter function timestampandtz_typmodout(integer) parallel safe;
+alter function pg_catalog.timezone(text, timestampandtz) parallel safe;
+alter function timestampandtz_to_timestamptz(timestampandtz) parallel safe;
+alter function timestampandtz_to_timestamp(timestampandtz) parallel safe;
+alter function timestamptz_to_timestampandtz(timestamptz) parallel safe;
+alter function timestamp_to_timestampandtz(timestamp) parallel safe;
+alter function timestampandtz_to_date(timestampandtz) parallel safe;
+alter function timestampandtz_cmp(timestampandtz, timestampandtz) parallel safe;
+alter function timestampandtz_pl_interval(timestampandtz, interval) parallel safe;
+alter function timestampandtz_mi_interval(timestampandtz, interval) parallel safe;
+alter function timestampandtz_mi(timestampandtz, timestampandtz) parallel safe;
+alter function tzmove(timestampandtz, text) parallel safe;
+alter function to_char(timestampandtz, text) parallel safe;
+alter function timestampandtz_scale(timestampandtz, integer) parallel safe;
+alter function date_part(text, timestampandtz) parallel safe;
+alter function date_trunc(text, timestampandtz) parallel safe;
+alter function date_trunc_at(text, timestampandtz, text) parallel safe;
+alter function timestampandtz_larger(timestampandtz, timestampandtz) parallel safe;
+alter function timestampandtz_smaller(timestampandtz, timestampandtz) parallel safe;
+alter function timestampandtz_eq(timestampandtz, timestampandtz) parallel safe;
+alter function timestampandtz_ne(timestampandtz, timestampandtz) parallel safe;
+alter function timestampandtz_lt(timestampandtz, timestampandtz) parallel safe;
+alter function timestampandtz_le(timestampandtz, timestampandtz) parallel safe;
+alter function timestampandtz_gt(timestampandtz, timestampandtz) parallel safe;
+alter function timestampandtz_ge(timestampandtz, timestampandtz) parallel safe;
+alter function timestampandtz_eq_date(timestampandtz, date) parallel safe;
+alter function timestampandtz_ne_date(timestampandtz, date) parallel safe;
+alter function timestampandtz_lt_date(timestampandtz, date) parallel safe;
+alter function timestampandtz_le_date(timestampandtz, date) parallel safe;
+alter function timestampandtz_gt_date(timestampandtz, date) parallel safe;
+alter function timestampandtz_ge_date(timestampandtz, date) parallel safe;
+-- alter aggregate can't add a combine function, sort operator or parallel safety, and dropping
+-- min and max would fail on any view using them, so they are set in the catalog.  The combine
+-- functions are the transition functions, which the aggregates already depend on, the sort
+-- operators need the dependency create aggregate would have recorded
+update pg_catalog.pg_aggregate set aggcombinefn = 'timestampandtz_larger'::pg_catalog.regproc, aggsortop = '>(timestampandtz, timestampandtz)'::pg_catalog.regoperator
+	where aggfnoid = 'max(timestampandtz)'::pg_catalog.regprocedure;
+update pg_catalog.pg_aggregate set aggcombinefn = 'timestampandtz_smaller'::pg_catalog.regproc, aggsortop = '<(timestampandtz, timestampandtz)'::pg_catalog.regoperator
+	where aggfnoid = 'min(timestampandtz)'::pg_catalog.regprocedure;
+update pg_catalog.pg_proc set proparallel = 's'
+	where oid in ('max(timestampandtz)'::pg_catalog.regprocedure, 'min(timestampandtz)'::pg_catalog.regprocedure);
+insert into pg_catalog.pg_depend (classid, objid, objsubid, refclassid, refobjid, refobjsubid, deptype)
+	values ('pg_catalog.pg_proc'::pg_catalog.regclass, 'max(timestampandtz)'::pg_catalog.regprocedure, 0,
+		'pg_catalog.pg_operator'::pg_catalog.regclass, '>(timestampandtz, timestampandtz)'::pg_catalog.regoperator, 0, 'n'),
+	('pg_catalog.pg_proc'::pg_catalog.regclass, 'min(timestampandtz)'::pg_catalog.regprocedure, 0,
+		'pg_catalog.pg_operator'::pg_catalog.regclass, '<(timestampandtz, timestampandtz)'::pg_catalog.regoperator, 0, 'n');
+
+create operator class timestampandtz_minmax_ops default for type timestampandtz using brin as
+	operator 1 <, operator 2 <=, operator 3 =, operator 4 >=, operator 5 >,
+	function 1 brin_minmax_opcinfo( internal ),
+	function 2 brin_minmax_add_value( internal, internal, internal, internal ),
+	function 3 brin_minmax_consistent( internal, internal, internal ),
+	function 4 brin_minmax_union( internal, internal, internal );
+alter operator family timestampandtz_minmax_ops using brin add
+	operator 1 < ( timestampandtz, timestamptz ), operator 2 <= ( timestampandtz, timestamptz ), operator 3 = ( timestampandtz, timestamptz ),
+	operator 4 >= ( timestampandtz, timestamptz ), operator 5 > ( timestampandtz, timestamptz );
+
+-- minmax-multi only exists from PostgreSQL 14 on
+create function timestampandtz_brin_minmax_multi_distance(internal, internal) returns float8 as 'timestampandtz.so' language C immutable strict parallel safe;
+do $$
+begin
+	if current_setting('server_version_num')::int >= 140000 then
+		create operator class timestampandtz_minmax_multi_ops for type timestampandtz using brin as
+			operator 1 <, operator 2 <=, operator 3 =, operator 4 >=, operator 5 >,
+			function 1 brin_minmax_multi_opcinfo( internal ),
+			function 2 brin_minmax_multi_add_value( internal, internal, internal, internal ),
+			function 3 brin_minmax_multi_consistent( internal, internal, internal, integer ),
+			function 4 brin_minmax_multi_union( internal, internal, internal ),
+			function 5 brin_minmax_multi_options( internal ),
+			function 11 timestampandtz_brin_minmax_multi_distance( internal, internal ),
+			storage brin_minmax_multi_summary;
+		alter operator family timestampandtz_minmax_multi_ops using brin add
+			operator 1 < ( timestampandtz, timestamptz ), operator 2 <= ( timestampandtz, timestamptz ), operator 3 = ( timestampandtz, timestamptz ),
+			operator 4 >= ( timestampandtz, timestamptz ), operator 5 > ( timestampandtz, timestamptz );
+	end if;
+end
+$$;
+
+create function timestampandtz_subdiff(timestampandtz, timestampandtz) returns float8 as 'timestampandtz.so' language C immutable strict parallel safe;
+-- the builtin range_ops gist and spgist classes index it, on PostgreSQL 14 and later it also gets timestampandtzmultirange
+create type timestampandtzrange as range ( subtype = timestampandtz, subtype_opclass = timestampandtz_ops, subtype_diff = timestampandtz_subdiff );
+
+create function timestampandtz_distance(timestampandtz, timestampandtz) returns interval as 'timestampandtz.so' language C immutable strict parallel safe;
+create operator <-> ( leftarg = timestampandtz, rightarg = timestampandtz, procedure = timestampandtz_distance, commutator = operator(<->) );
+
+create type timestampandtzkey;
+create function timestampandtzkey_in(cstring) returns timestampandtzkey as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtzkey_out(timestampandtzkey) returns cstring as 'timestampandtz.so' language C immutable strict parallel safe;
+create type timestampandtzkey ( internallength = 16, alignment = double, input = timestampandtzkey_in, output = timestampandtzkey_out );
+create function timestampandtz_gist_consistent(internal, timestampandtz, smallint, oid, internal) returns bool as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_gist_union(internal, internal) returns timestampandtzkey as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_gist_compress(internal) returns internal as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_gist_penalty(internal, internal, internal) returns internal as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_gist_picksplit(internal, internal) returns internal as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_gist_same(timestampandtzkey, timestampandtzkey, internal) returns internal as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_gist_distance(internal, timestampandtz, smallint, oid, internal) returns float8 as 'timestampandtz.so' language C immutable strict parallel safe;
+create operator class timestampandtz_gist_ops default for type timestampandtz using gist as
+	operator 1 <, operator 2 <=, operator 3 =, operator 4 >=, operator 5 >, operator 6 <>,
+	operator 15 <-> ( timestampandtz, timestampandtz ) for order by interval_ops,
+	function 1 timestampandtz_gist_consistent( internal, timestampandtz, smallint, oid, internal ),
+	function 2 timestampandtz_gist_union( internal, internal ),
+	function 3 timestampandtz_gist_compress( internal ),
+	function 5 timestampandtz_gist_penalty( internal, internal, internal ),
+	function 6 timestampandtz_gist_picksplit( internal, internal ),
+	function 7 timestampandtz_gist_same( timestampandtzkey, timestampandtzkey, internal ),
+	function 8 timestampandtz_gist_distance( internal, timestampandtz, smallint, oid, internal ),
+	storage timestampandtzkey;
+alter operator family timestampandtz_gist_ops using gist add
+	operator 1 < ( timestampandtz, timestamptz ), operator 2 <= ( timestampandtz, timestamptz ), operator 3 = ( timestampandtz, timestamptz ),
+	operator 4 >= ( timestampandtz, timestamptz ), operator 5 > ( timestampandtz, timestamptz ), operator 6 <> ( timestampandtz, timestamptz );
+
+create function timestampandtz_gin_extract_value(timestampandtz, internal) returns internal as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_gin_extract_query(timestampandtz, internal, smallint, internal, internal) returns internal as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_gin_compare_partial(timestampandtz, timestampandtz, smallint, internal) returns integer as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_gin_consistent(internal, smallint, timestampandtz, integer, internal, internal) returns bool as 'timestampandtz.so' language C immutable strict parallel safe;
+create operator class timestampandtz_gin_ops default for type timestampandtz using gin as
+	operator 1 <, operator 2 <=, operator 3 =, operator 4 >=, operator 5 >,
+	function 1 timestampandtz_cmp( timestampandtz, timestampandtz ),
+	function 2 timestampandtz_gin_extract_value( timestampandtz, internal ),
+	function 3 timestampandtz_gin_extract_query( timestampandtz, internal, smallint, internal, internal ),
+	function 4 timestampandtz_gin_consistent( internal, smallint, timestampandtz, integer, internal, internal ),
+	function 5 timestampandtz_gin_compare_partial( timestampandtz, timestampandtz, smallint, internal ),
+	storage timestampandtz;
+create operator class timestampandtz_array_ops default for type timestampandtz[] using gin as
+	operator 1 && ( anyarray, anyarray ), operator 2 @> ( anyarray, anyarray ), operator 3 <@ ( anyarray, anyarray ), operator 4 = ( anyarray, anyarray ),
+	function 1 timestampandtz_cmp( timestampandtz, timestampandtz ),
+	function 2 ginarrayextract( anyarray, internal, internal ),
+	function 3 ginqueryarrayextract( anyarray, internal, smallint, internal, internal, internal, internal ),
+	function 4 ginarrayconsistent( internal, smallint, anyarray, integer, internal, internal, internal, internal ),
+	function 6 ginarraytriconsistent( internal, smallint, anyarray, integer, internal, internal, internal ),
+	storage timestampandtz;
+
+create function in_range_timestampandtz_interval(timestampandtz, timestampandtz, interval, bool, bool) returns bool as 'timestampandtz.so' language C stable strict parallel safe;
+alter operator family timestampandtz_ops using btree add
+	function 3 ( timestampandtz, interval ) in_range_timestampandtz_interval( timestampandtz, timestampandtz, interval, bool, bool );
+
+create function timestampandtz_cmp_date(timestampandtz, date) returns int4 as 'timestampandtz.so' language C immutable strict parallel safe;
+create function date_cmp_timestampandtz(date, timestampandtz) returns int4 as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_local_eq(timestampandtz, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_local_ne(timestampandtz, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_local_lt(timestampandtz, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_local_le(timestampandtz, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_local_gt(timestampandtz, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_local_ge(timestampandtz, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_local_cmp(timestampandtz, timestampandtz) returns int4 as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_local_sortsupport(internal) returns void as 'timestampandtz.so' language C immutable strict parallel safe;
+create operator ~=~ ( leftarg = timestampandtz, rightarg = timestampandtz, procedure = timestampandtz_local_eq, commutator = operator(~=~), negator = operator(~<>~), restrict = eqsel, join = eqjoinsel );
+create operator ~<>~ ( leftarg = timestampandtz, rightarg = timestampandtz, procedure = timestampandtz_local_ne, commutator = operator(~<>~), negator = operator(~=~), restrict = neqsel, join = neqjoinsel );
+create operator ~<~ ( leftarg = timestampandtz, rightarg = timestampandtz, procedure = timestampandtz_local_lt, commutator = operator(~>~), negator = operator(~>=~), restrict = scalarltsel, join = scalarltjoinsel );
+create operator ~<=~ ( leftarg = timestampandtz, rightarg = timestampandtz, procedure = timestampandtz_local_le, commutator = operator(~>=~), negator = operator(~>~), restrict = scalarlesel, join = scalarlejoinsel );
+create operator ~>~ ( leftarg = timestampandtz, rightarg = timestampandtz, procedure = timestampandtz_local_gt, commutator = operator(~<~), negator = operator(~<=~), restrict = scalargtsel, join = scalargtjoinsel );
+create operator ~>=~ ( leftarg = timestampandtz, rightarg = timestampandtz, procedure = timestampandtz_local_ge, commutator = operator(~<=~), negator = operator(~<~), restrict = scalargesel, join = scalargejoinsel );
+-- ordered by local wall clock time only, the date comparisons work on local time so they live here
+create operator class timestampandtz_local_ops for type timestampandtz using btree as
+	operator 1 ~<~, operator 2 ~<=~, operator 3 ~=~, operator 4 ~>=~, operator 5 ~>~,
+	function 1 timestampandtz_local_cmp( timestampandtz, timestampandtz ),
+	function 2 timestampandtz_local_sortsupport( internal );
+alter operator family timestampandtz_local_ops using btree add
+	operator 1 < ( timestampandtz, date ), operator 2 <= ( timestampandtz, date ), operator 3 = ( timestampandtz, date ),
+	operator 4 >= ( timestampandtz, date ), operator 5 > ( timestampandtz, date ),
+	function 1 ( timestampandtz, date ) timestampandtz_cmp_date( timestampandtz, date ),
+	operator 1 < ( date, timestampandtz ), operator 2 <= ( date, timestampandtz ), operator 3 = ( date, timestampandtz ),
+	operator 4 >= ( date, timestampandtz ), operator 5 > ( date, timestampandtz ),
+	function 1 ( date, timestampandtz ) date_cmp_timestampandtz( date, timestampandtz ),
+	operator 1 < ( date, date ), operator 2 <= ( date, date ), operator 3 = ( date, date ),
+	operator 4 >= ( date, date ), operator 5 > ( date, date ),
+	function 1 ( date, date ) date_cmp( date, date );
+
+create function timestampandtz_image_eq(timestampandtz, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_image_ne(timestampandtz, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_image_lt(timestampandtz, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_image_le(timestampandtz, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_image_gt(timestampandtz, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_image_ge(timestampandtz, timestampandtz) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_image_cmp(timestampandtz, timestampandtz) returns int4 as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz_image_sortsupport(internal) returns void as 'timestampandtz.so' language C immutable strict parallel safe;
+create operator *= ( leftarg = timestampandtz, rightarg = timestampandtz, procedure = timestampandtz_image_eq, commutator = operator(*=), negator = operator(*<>), restrict = eqsel, join = eqjoinsel );
+create operator *<> ( leftarg = timestampandtz, rightarg = timestampandtz, procedure = timestampandtz_image_ne, commutator = operator(*<>), negator = operator(*=), restrict = neqsel, join = neqjoinsel );
+create operator *< ( leftarg = timestampandtz, rightarg = timestampandtz, procedure = timestampandtz_image_lt, commutator = operator(*>), negator = operator(*>=), restrict = scalarltsel, join = scalarltjoinsel );
+create operator *<= ( leftarg = timestampandtz, rightarg = timestampandtz, procedure = timestampandtz_image_le, commutator = operator(*>=), negator = operator(*>), restrict = scalarlesel, join = scalarlejoinsel );
+create operator *> ( leftarg = timestampandtz, rightarg = timestampandtz, procedure = timestampandtz_image_gt, commutator = operator(*<), negator = operator(*<=), restrict = scalargtsel, join = scalargtjoinsel );
+create operator *>= ( leftarg = timestampandtz, rightarg = timestampandtz, procedure = timestampandtz_image_ge, commutator = operator(*<=), negator = operator(*<), restrict = scalargesel, join = scalargejoinsel );
+-- ordered by utc time then zone, equal values are identical so btree can deduplicate them
+create operator class timestampandtz_image_ops for type timestampandtz using btree as
+	operator 1 *<, operator 2 *<=, operator 3 *=, operator 4 *>=, operator 5 *>,
+	function 1 timestampandtz_image_cmp( timestampandtz, timestampandtz ),
+	function 2 timestampandtz_image_sortsupport( internal );
+-- equalimage support functions only exist from PostgreSQL 13 on
+do $$
+begin
+	if current_setting('server_version_num')::int >= 130000 then
+		alter operator family timestampandtz_image_ops using btree add
+			function 4 ( timestampandtz, timestampandtz ) btequalimage( oid );
+	end if;
+end
+$$;
+
+-- the same value packed into an int64 and passed by value, utc times from about 1715 to 2285
+create type timestampandtz8;
+create function timestampandtz8_in(cstring, oid, integer) returns timestampandtz8 as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz8_out(timestampandtz8) returns cstring as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz8_recv(internal, oid, integer) returns timestampandtz8 as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz8_send(timestampandtz8) returns bytea as 'timestampandtz.so' language C immutable strict parallel safe;
+create type timestampandtz8 (
+	internallength = 8,
+	passedbyvalue,
+	alignment = double,
+	input = timestampandtz8_in,
+	output = timestampandtz8_out,
+	send = timestampandtz8_send,
+	receive = timestampandtz8_recv
+);
+create function timestampandtz_to_timestampandtz8(timestampandtz) returns timestampandtz8 as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz8_to_timestampandtz(timestampandtz8) returns timestampandtz as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz8_to_timestamptz(timestampandtz8) returns timestamptz as 'timestampandtz.so' language C immutable strict parallel safe;
+create cast(timestampandtz as timestampandtz8) with function timestampandtz_to_timestampandtz8(timestampandtz) as assignment;
+create cast(timestampandtz8 as timestampandtz) with function timestampandtz8_to_timestampandtz(timestampandtz8) as implicit;
+create cast(timestampandtz8 as timestamptz) with function timestampandtz8_to_timestamptz(timestampandtz8);
+create function timestampandtz8_eq(timestampandtz8, timestampandtz8) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz8_ne(timestampandtz8, timestampandtz8) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz8_lt(timestampandtz8, timestampandtz8) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz8_le(timestampandtz8, timestampandtz8) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz8_gt(timestampandtz8, timestampandtz8) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz8_ge(timestampandtz8, timestampandtz8) returns boolean as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz8_cmp(timestampandtz8, timestampandtz8) returns int4 as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz8_sortsupport(internal) returns void as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz8_hash(timestampandtz8) returns int4 as 'timestampandtz.so' language C immutable strict parallel safe;
+create function timestampandtz8_hash_extended(timestampandtz8, int8) returns int8 as 'timestampandtz.so' language C immutable strict parallel safe;
+create operator = ( leftarg = timestampandtz8, rightarg = timestampandtz8, procedure = timestampandtz8_eq, commutator = operator(=), negator = operator(<>), restrict = eqsel, join = eqjoinsel, hashes, merges );
+create operator <> ( leftarg = timestampandtz8, rightarg = timestampandtz8, procedure = timestampandtz8_ne, commutator = operator(<>), negator = operator(=), restrict = neqsel, join = neqjoinsel );
+create operator < ( leftarg = timestampandtz8, rightarg = timestampandtz8, procedure = timestampandtz8_lt, commutator = operator(>), negator = operator(>=), restrict = scalarltsel, join = scalarltjoinsel );
+create operator <= ( leftarg = timestampandtz8, rightarg = timestampandtz8, procedure = timestampandtz8_le, commutator = operator(>=), negator = operator(>), restrict = scalarlesel, join = scalarlejoinsel );
+create operator > ( leftarg = timestampandtz8, rightarg = timestampandtz8, procedure = timestampandtz8_gt, commutator = operator(<), negator = operator(<=), restrict = scalargtsel, join = scalargtjoinsel );
+create operator >= ( leftarg = timestampandtz8, rightarg = timestampandtz8, procedure = timestampandtz8_ge, commutator = operator(<=), negator = operator(<), restrict = scalargesel, join = scalargejoinsel );
+create operator class timestampandtz8_ops default for type timestampandtz8 using btree as
+	operator 1 <, operator 2 <=, operator 3 =, operator 4 >=, operator 5 >,
+	function 1 timestampandtz8_cmp( timestampandtz8, timestampandtz8 ),
+	function 2 timestampandtz8_sortsupport( internal );
+create operator class timestampandtz8_ops default for type timestampandtz8 using hash as
+	operator 1 =,
+	function 1 timestampandtz8_hash( timestampandtz8 ),
+	function 2 timestampandtz8_hash_extended( timestampandtz8, int8 );
@@ -13,6 +13,19 @@
 
 #include "utils/date.h"
 #include "utils/array.h"
+#include "utils/sortsupport.h"
+
+#if PG_VERSION_NUM >= 160000
+#include "nodes/miscnodes.h"
+#else
+/* no soft errors before 16, an input error is always a hard one */
+#define ereturn(context, dummy_value, rest) \
+	do { \
+		(void) (context); \
+		ereport(ERROR, rest); \
+		return dummy_value; \
+	} while(0)
+#endif
 
 PG_MODULE_MAGIC;
 
@@ -53,14 +66,209 @@ Datum timestampandtz_to_date(PG_FUNCTION_ARGS);
 Datum timestampandtz_larger(PG_FUNCTION_ARGS);
 Datum timestampandtz_smaller(PG_FUNCTION_ARGS);
 Datum timestampandtz_cmp_date(PG_FUNCTION_ARGS);
-
+Datum timestampandtz_hash(PG_FUNCTION_ARGS);
+Datum timestampandtz_hash_extended(PG_FUNCTION_ARGS);
+Datum timestampandtz_sortsupport(PG_FUNCTION_ARGS);
+Datum timestampandtz_brin_minmax_multi_distance(PG_FUNCTION_ARGS);
+Datum timestampandtz_subdiff(PG_FUNCTION_ARGS);
+Datum timestampandtz_distance(PG_FUNCTION_ARGS);
+Datum in_range_timestampandtz_interval(PG_FUNCTION_ARGS);
+Datum timestampandtzkey_in(PG_FUNCTION_ARGS);
+Datum timestampandtzkey_out(PG_FUNCTION_ARGS);
+Datum timestampandtz_gist_consistent(PG_FUNCTION_ARGS);
+Datum timestampandtz_gist_union(PG_FUNCTION_ARGS);
+Datum timestampandtz_gist_compress(PG_FUNCTION_ARGS);
+Datum timestampandtz_gist_penalty(PG_FUNCTION_ARGS);
+Datum timestampandtz_gist_picksplit(PG_FUNCTION_ARGS);
+Datum timestampandtz_gist_same(PG_FUNCTION_ARGS);
+Datum timestampandtz_gist_distance(PG_FUNCTION_ARGS);
+Datum timestampandtz_gin_extract_value(PG_FUNCTION_ARGS);
+Datum timestampandtz_gin_extract_query(PG_FUNCTION_ARGS);
+Datum timestampandtz_gin_compare_partial(PG_FUNCTION_ARGS);
+Datum timestampandtz_gin_consistent(PG_FUNCTION_ARGS);
+Datum date_eq_timestampandtz(PG_FUNCTION_ARGS);
+Datum date_ne_timestampandtz(PG_FUNCTION_ARGS);
+Datum date_gt_timestampandtz(PG_FUNCTION_ARGS);
+Datum date_ge_timestampandtz(PG_FUNCTION_ARGS);
+Datum date_lt_timestampandtz(PG_FUNCTION_ARGS);
+Datum date_le_timestampandtz(PG_FUNCTION_ARGS);
+Datum timestampandtz_eq_timestamptz(PG_FUNCTION_ARGS);
+Datum timestampandtz_ne_timestamptz(PG_FUNCTION_ARGS);
+Datum timestampandtz_lt_timestamptz(PG_FUNCTION_ARGS);
+Datum timestampandtz_le_timestamptz(PG_FUNCTION_ARGS);
+Datum timestampandtz_gt_timestamptz(PG_FUNCTION_ARGS);
+Datum timestampandtz_ge_timestamptz(PG_FUNCTION_ARGS);
+Datum timestampandtz_cmp_timestamptz(PG_FUNCTION_ARGS);
+Datum timestamptz_eq_timestampandtz(PG_FUNCTION_ARGS);
+Datum timestamptz_ne_timestampandtz(PG_FUNCTION_ARGS);
+Datum timestamptz_lt_timestampandtz(PG_FUNCTION_ARGS);
+Datum timestamptz_le_timestampandtz(PG_FUNCTION_ARGS);
+Datum timestamptz_gt_timestampandtz(PG_FUNCTION_ARGS);
+Datum timestamptz_ge_timestampandtz(PG_FUNCTION_ARGS);
+Datum timestamptz_cmp_timestampandtz(PG_FUNCTION_ARGS);
+Datum date_cmp_timestampandtz(PG_FUNCTION_ARGS);
+Datum timestampandtz_local_eq(PG_FUNCTION_ARGS);
+Datum timestampandtz_local_ne(PG_FUNCTION_ARGS);
+Datum timestampandtz_local_lt(PG_FUNCTION_ARGS);
+Datum timestampandtz_local_le(PG_FUNCTION_ARGS);
+Datum timestampandtz_local_gt(PG_FUNCTION_ARGS);
+Datum timestampandtz_local_ge(PG_FUNCTION_ARGS);
+Datum timestampandtz_local_cmp(PG_FUNCTION_ARGS);
+Datum timestampandtz_local_sortsupport(PG_FUNCTION_ARGS);
+Datum timestampandtz_image_eq(PG_FUNCTION_ARGS);
+Datum timestampandtz_image_ne(PG_FUNCTION_ARGS);
+Datum timestampandtz_image_lt(PG_FUNCTION_ARGS);
+Datum timestampandtz_image_le(PG_FUNCTION_ARGS);
+Datum timestampandtz_image_gt(PG_FUNCTION_ARGS);
+Datum timestampandtz_image_ge(PG_FUNCTION_ARGS);
+Datum timestampandtz_image_cmp(PG_FUNCTION_ARGS);
+Datum timestampandtz_image_sortsupport(PG_FUNCTION_ARGS);
+Datum timestampandtz8_in(PG_FUNCTION_ARGS);
+Datum timestampandtz8_out(PG_FUNCTION_ARGS);
+Datum timestampandtz8_recv(PG_FUNCTION_ARGS);
+Datum timestampandtz8_send(PG_FUNCTION_ARGS);
+Datum timestampandtz_to_timestampandtz8(PG_FUNCTION_ARGS);
+Datum timestampandtz8_to_timestampandtz(PG_FUNCTION_ARGS);
+Datum timestampandtz8_to_timestamptz(PG_FUNCTION_ARGS);
+Datum timestampandtz8_eq(PG_FUNCTION_ARGS);
+Datum timestampandtz8_ne(PG_FUNCTION_ARGS);
+Datum timestampandtz8_lt(PG_FUNCTION_ARGS);
+Datum timestampandtz8_le(PG_FUNCTION_ARGS);
+Datum timestampandtz8_gt(PG_FUNCTION_ARGS);
+Datum timestampandtz8_ge(PG_FUNCTION_ARGS);
+Datum timestampandtz8_cmp(PG_FUNCTION_ARGS);
+Datum timestampandtz8_sortsupport(PG_FUNCTION_ARGS);
+Datum timestampandtz8_hash(PG_FUNCTION_ARGS);
+Datum timestampandtz8_hash_extended(PG_FUNCTION_ARGS);
+
+/*
+ * On disk a value is the 8 byte utc time followed by the 2 byte zone id with
+ * nothing in between, internallength 10.  The type is double aligned so time
+ * can be read in place (installs upgraded from 1.0.0 keep int alignment, as
+ * the alignment of a type can't change under stored data).
+ */
 typedef struct TimestampAndTz {
 	Timestamp time;
 	short tz;
 } TimestampAndTz;
 
+#define TIMESTAMPANDTZ_SIZE 10
+
 #include "zones.c"
+
+static const char *tzid_to_tzname(int id)
+{
+	return timezones_by_id[id - 1]->name;
+}
+
+/* per-backend pg_tz for each timezone id, filled in the first time the id is used */
+static pg_tz *tzid_tzp_cache[NTIMEZONES + 1];
+
+static pg_tz *tzid_to_tzp(int id)
+{
+	pg_tz *tzp;
+
+	Assert(id >= 1 && id <= (int) NTIMEZONES);
+	tzp = tzid_tzp_cache[id];
+
+	/* pg_tzset keeps its zones for the life of the backend, so the pointer stays valid */
+	if(tzp == NULL)
+	{
+		tzp = pg_tzset(tzid_to_tzname(id));
+		tzid_tzp_cache[id] = tzp;
+	}
+
+	return tzp;
+}
+
+/* case-insensitive zone name hash, must match tzname_hash() in sorter.c */
+static uint32 tzname_hash(const char *name, size_t len)
+{
+	uint32 h = TZHASH_SEED;
+	const char *end = name + len;
+
+	for(; name < end; name++)
+		h = (h ^ (unsigned char) pg_toupper((unsigned char) *name)) * 16777619;
+
+	h ^= h >> 16;
+	h *= 0x85ebca6b;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35;
+	h ^= h >> 16;
+	return h;
+}
+
+/* zone id of the first len bytes of name, 0 if they aren't a known zone */
+static int tzname_to_tzid_len(const char *name, size_t len)
+{
+	uint32 h = tzname_hash(name, len);
+	uint32 d = tzhash_displacements[h >> (32 - TZHASH_BUCKET_BITS)];
+	int id = tzhash_ids[(h ^ d) & (TZHASH_SIZE - 1)];
+	const char *upper;
+
+	if(id == 0 || (size_t) timezones_by_id[id - 1]->namelen != len)
+		return 0;
+
+	/* the hash is perfect for known zones, so a single compare decides it */
+	upper = timezones_by_id[id - 1]->nameupper;
+	for(; len > 0; name++, upper++, len--)
+	{
+		if((unsigned char) pg_toupper((unsigned char) *name) != (unsigned char) *upper)
+			return 0;
+	}
+
+	return id;
+}
+
+static int tzname_to_tzid(const char *name)
+{
+	return tzname_to_tzid_len(name, strlen(name));
+}
+
+/* timezone id of the TimeZone setting, only looked up again when session_timezone changes */
+static pg_tz *session_tzid_zone = NULL;
+static int session_tzid = 0;
+
+static int session_timezone_tzid(void)
+{
+	if(session_timezone != session_tzid_zone)
+	{
+		session_tzid = tzname_to_tzid(pg_get_timezone_name(session_timezone));
+		session_tzid_zone = session_timezone;
+	}
+
+	return session_tzid;
+}
+
+#include "transitions.c"
 #include "to_char.c"
+#include "gist.c"
+#include "gin.c"
+#include "packed.c"
+
+/* when set, utc offsets given with the input are checked against the zone */
+static bool check_offsets = false;
+
+void _PG_init(void);
+void _PG_init(void)
+{
+	DefineCustomBoolVariable("timestampandtz.check_offsets",
+		"Checks that UTC offsets given in input agree with the time zone.",
+		NULL, &check_offsets, false,
+		PGC_USERSET, 0, NULL, NULL, NULL);
+	DefineCustomIntVariable("timestampandtz.transition_start_year",
+		"First year covered by the precomputed timezone transition tables.",
+		NULL, &transition_start_year, 1900, 1, 9999,
+		PGC_USERSET, 0, NULL, transitions_assign_year, NULL);
+	DefineCustomIntVariable("timestampandtz.transition_end_year",
+		"Last year covered by the precomputed timezone transition tables.",
+		NULL, &transition_end_year, 2100, 1, 9999,
+		PGC_USERSET, 0, NULL, transitions_assign_year, NULL);
+
+	/* preloaded, build the transition tables once for all backends */
+	if(process_shared_preload_libraries_in_progress)
+		transitions_install_shmem_hooks();
+}
 
 static void debug_tm(struct pg_tm *tm)
 {
@@ -208,6 +416,9 @@ static void AdjustTimestampForTypmod(Timestamp *time, int32 typmod)
 static Datum gen_timestamp(Timestamp stamp, int tz)
 {
 	TimestampAndTz *result = (TimestampAndTz *) palloc0(sizeof(TimestampAndTz));
+
+	StaticAssertStmt(offsetof(TimestampAndTz, tz) + sizeof(short) == TIMESTAMPANDTZ_SIZE,
+		"TimestampAndTz must match the on-disk layout");
 	result->time = stamp;
 	result->tz = tz;
 	PG_RETURN_POINTER(result);
@@ -222,14 +433,24 @@ static Timestamp tolocal(TimestampAndTz *dt)
 	int tz;
 	pg_tz *tzp = NULL;
 
-	if(TIMESTAMP_NOT_FINITE(dt->time) || dt->tz == 0)
+	/* infinities stay put so local order agrees with utc order at the ends */
+	if(TIMESTAMP_NOT_FINITE(dt->time))
+	{
+		return dt->time;
+	}
+	else if(dt->tz == 0)
 	{
 		return DT_NOEND;
 	}
+	else if(tzid_utc_offset(dt->tz, dt->time, &tz, NULL))
+	{
+		/* local time is just the utc time plus the offset in effect */
+		return dt->time + (Timestamp) tz * USECS_PER_SEC;
+	}
 	else
 	{
 		tzn = tzid_to_tzname(dt->tz);
-		tzp = pg_tzset(tzn);
+		tzp = tzid_to_tzp(dt->tz);
 
 		/* convert from the local timestamp to a local tm struct */
 		if (timestamp2tm(dt->time, &tz, &tm, &fsec, NULL, tzp) != 0)
@@ -248,11 +469,218 @@ static Timestamp tolocal(TimestampAndTz *dt)
 	}
 }
 
+/* value of n ascii digits at s, -1 if any of them isn't a digit */
+static inline int parse_digits(const char *s, int n)
+{
+	int value = 0;
+
+	for(; n > 0; s++, n--)
+	{
+		if(*s < '0' || *s > '9')
+			return -1;
+		value = value * 10 + (*s - '0');
+	}
+
+	return value;
+}
+
+/* does a text field of the general parser name a zone offset, like Z or EST */
+static bool field_is_zone_abbrev(int i, char *field)
+{
+	int type, val;
+	pg_tz *valtz;
+#if PG_VERSION_NUM >= 160000
+	DateTimeErrorExtra extra;
+
+	if(DecodeTimezoneAbbrev(i, field, &type, &val, &valtz, &extra) != 0)
+		return false;
+#else
+	type = DecodeTimezoneAbbrev(i, field, &val, &valtz);
+#endif
+	/* z and zulu are in the builtin keyword table rather than the abbreviations */
+	if(type == UNKNOWN_FIELD)
+		type = DecodeSpecial(i, field, &val);
+
+	return type == TZ || type == DTZ || type == DYNTZ;
+}
+
+/*
+ * Errors in the input functions go through escontext, so on 16 and later
+ * pg_input_is_valid() and COPY ... ON_ERROR get them back without a
+ * subtransaction.
+ *
+ * An offset given with the input fixes the instant by itself.  With
+ * timestampandtz.check_offsets on, make sure the zone really is at that
+ * offset then (tz is seconds west, as DecodeDateTime gives it).
+ */
+static bool timestampandtz_check_offset(Timestamp utc, int tz, int tzid, const char *str, Node *escontext)
+{
+	int gmtoff;
+
+	if(!check_offsets || TIMESTAMP_NOT_FINITE(utc))
+		return true;
+
+	if(!tzid_utc_offset(tzid, utc, &gmtoff, NULL))
+	{
+		struct pg_tm tt;
+		fsec_t fsec;
+		int ztz;
+
+		if(timestamp2tm(utc, &ztz, &tt, &fsec, NULL, tzid_to_tzp(tzid)) != 0)
+			return true;
+		gmtoff = -ztz;
+	}
+
+	if(gmtoff != -tz)
+		ereturn(escontext, false,
+			(errcode(ERRCODE_INVALID_DATETIME_FORMAT),
+			 errmsg("UTC offset of timestampandtz \"%s\" does not match time zone \"%s\"",
+					str, tzid_to_tzname(tzid))));
+	return true;
+}
+
+/*
+ * Single pass parse of the canonical form YYYY-MM-DD[ T]HH:MM[:SS[.ffffff]],
+ * then an optional UTC offset (Z, +HH, +HHMM or +HH:MM) and an optional zone,
+ * either @ Zone/Name or the RFC 9557 [Zone/Name], in place and without
+ * allocating.  Returns false for anything else (or anything out of range) and
+ * the caller goes through the general date/time parser instead.  Any offset
+ * given is left in tz for the caller to check.
+ */
+static bool timestampandtz_in_iso(const char *str, Timestamp *result, int *tzid, int *tz, bool *has_offset)
+{
+	const char *p = str;
+	struct pg_tm tt, *tm = &tt;
+	fsec_t fsec = 0;
+
+	*has_offset = false;
+
+	memset(tm, 0, sizeof(*tm));
+
+	if((tm->tm_year = parse_digits(p, 4)) < 1 || p[4] != '-' ||
+		(tm->tm_mon = parse_digits(p + 5, 2)) < 1 || tm->tm_mon > MONTHS_PER_YEAR || p[7] != '-' ||
+		(tm->tm_mday = parse_digits(p + 8, 2)) < 1 || tm->tm_mday > day_tab[isleap(tm->tm_year)][tm->tm_mon - 1] ||
+		(p[10] != ' ' && p[10] != 'T') ||
+		(tm->tm_hour = parse_digits(p + 11, 2)) < 0 || tm->tm_hour >= HOURS_PER_DAY || p[13] != ':' ||
+		(tm->tm_min = parse_digits(p + 14, 2)) < 0 || tm->tm_min >= MINS_PER_HOUR)
+		return false;
+	p += 16;
+
+	if(*p == ':')
+	{
+		if((tm->tm_sec = parse_digits(p + 1, 2)) < 0 || tm->tm_sec >= SECS_PER_MINUTE)
+			return false;
+		p += 3;
+
+		if(*p == '.')
+		{
+			int scale = 100000;
+
+			for(p++; *p >= '0' && *p <= '9'; p++, scale /= 10)
+			{
+				/* more digits than microseconds need rounding, leave that to the general parser */
+				if(scale == 0)
+					return false;
+				fsec += (*p - '0') * scale;
+			}
+		}
+	}
+
+	/* a numeric offset may be set off by spaces */
+	if(isspace((unsigned char) *p))
+	{
+		const char *q = p;
+
+		while(isspace((unsigned char) *q))
+			q++;
+		if(*q == '+' || *q == '-')
+			p = q;
+	}
+
+	if(*p == 'Z')
+	{
+		*tz = 0;
+		*has_offset = true;
+		p++;
+	}
+	else if(*p == '+' || *p == '-')
+	{
+		int sign = (*p == '-') ? 1 : -1;
+		int hours, minutes;
+
+		if((hours = parse_digits(p + 1, 2)) < 0 || hours > 15)
+			return false;
+		if(p[3] == ':')
+		{
+			if((minutes = parse_digits(p + 4, 2)) < 0 || minutes >= MINS_PER_HOUR)
+				return false;
+			p += 6;
+		}
+		else if((minutes = parse_digits(p + 3, 2)) >= 0)
+		{
+			if(minutes >= MINS_PER_HOUR)
+				return false;
+			p += 5;
+		}
+		else
+		{
+			minutes = 0;
+			p += 3;
+		}
+
+		/* seconds west, like DecodeDateTime */
+		*tz = sign * (hours * MINS_PER_HOUR + minutes) * SECS_PER_MINUTE;
+		*has_offset = true;
+	}
+
+	while(isspace((unsigned char) *p))
+		p++;
+
+	if(*p == '@' || *p == '[')
+	{
+		const char *name;
+
+		if(*p == '[')
+		{
+			/* a ! marks the zone as critical, we always treat it so */
+			if(*++p == '!')
+				p++;
+			for(name = p; *p && *p != ']'; p++)
+				;
+			if(*p != ']')
+				return false;
+			*tzid = tzname_to_tzid_len(name, p - name);
+			p++;
+		}
+		else
+		{
+			for(p++; isspace((unsigned char) *p); p++)
+				;
+			for(name = p; *p && !isspace((unsigned char) *p); p++)
+				;
+			*tzid = tzname_to_tzid_len(name, p - name);
+		}
+
+		while(isspace((unsigned char) *p))
+			p++;
+	}
+	else
+		*tzid = session_timezone_tzid();
+
+	if(*p != '\0' || *tzid == 0)
+		return false;
+
+	if(!*has_offset)
+		*tz = DetermineTimeZoneOffset(tm, tzid_to_tzp(*tzid));
+	return tm2timestamp(tm, fsec, tz, result) == 0;
+}
+
 PG_FUNCTION_INFO_V1(timestampandtz_in);
 Datum timestampandtz_in(PG_FUNCTION_ARGS)
 {
 	char *str = PG_GETARG_CSTRING(0);
 	int32 typmod = PG_GETARG_INT32(2);
+	Node *escontext = fcinfo->context;
 	Timestamp timestamp;
 	fsec_t fsec;
 	struct pg_tm tt, *tm = &tt;
@@ -264,11 +692,26 @@ Datum timestampandtz_in(PG_FUNCTION_ARGS)
 	char *tzn;
 	int tzid;
 	int tz_index;
+	bool has_offset = false;
+	int i;
+#if PG_VERSION_NUM >= 160000
+	DateTimeErrorExtra extra;
+#endif
 
-	tz_index = strcspn(str, "@");
+	if(timestampandtz_in_iso(str, &timestamp, &tzid, &tz, &has_offset))
+	{
+		if(has_offset && !timestampandtz_check_offset(timestamp, tz, tzid, str, escontext))
+			PG_RETURN_NULL();
+		AdjustTimestampForTypmod(&timestamp, typmod);
+		return gen_timestamp(timestamp, tzid);
+	}
+
+	tz_index = strcspn(str, "@[");
 	if(tz_index < strlen(str))
 	{
-		/* split the date/time string and the timezone string at the @ */
+		bool bracket = str[tz_index] == '[';
+
+		/* split the date/time string and the timezone string at the @ (or [) */
 		str = pstrdup(str);
 		str[tz_index] = 0x00;
 		tzn = pstrdup(&str[tz_index] + 1);
@@ -281,38 +724,65 @@ Datum timestampandtz_in(PG_FUNCTION_ARGS)
 		while(isspace(*tzn)) tzn++;
 		while(isspace(tzn[strlen(tzn) - 1])) tzn[strlen(tzn) - 1] = 0x00;
 
+		/* RFC 9557 [Zone/Name] or [!Zone/Name], an unclosed bracket matches no zone */
+		if(bracket)
+		{
+			if(*tzn == '!')
+				tzn++;
+			if(tzn[0] != 0x00 && tzn[strlen(tzn) - 1] == ']')
+				tzn[strlen(tzn) - 1] = 0x00;
+			else
+				tzn[0] = 0x00;
+		}
+
 		/* find our timezone id */
 		tzid = tzname_to_tzid(tzn);
 	}
 	else
 	{
 		/* find our timezone id for the current session timezone */
-		tzn = pstrdup(pg_get_timezone_name(session_timezone));
-		tzid = tzname_to_tzid(tzn);
+		tzn = (char *) pg_get_timezone_name(session_timezone);
+		tzid = session_timezone_tzid();
 	}
 
 	if(tzid == 0)
-	{
-		elog(ERROR, "missing timezone ID \"%s\" while parsing timestampandtz \"%s\"", tzn, str);
-		return gen_timestamp(DT_NOEND, 0);
-	}
+		ereturn(escontext, (Datum) 0,
+			(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
+			 errmsg("missing timezone ID \"%s\" while parsing timestampandtz \"%s\"", tzn, str)));
 
 	/* standard date/time parse */
 	dterr = ParseDateTime(str, workbuf, sizeof(workbuf), field, ftype, MAXDATEFIELDS, &nf);
+#if PG_VERSION_NUM >= 160000
+	if(dterr == 0)
+		dterr = DecodeDateTime(field, ftype, nf, &dtype, tm, &fsec, &tz, &extra);
+	if(dterr != 0)
+	{
+		DateTimeParseError(dterr, &extra, str, "timestamp and time zone", escontext);
+		PG_RETURN_NULL();
+	}
+#else
 	if(dterr == 0)
 		dterr = DecodeDateTime(field, ftype, nf, &dtype, tm, &fsec, &tz);
 	if(dterr != 0)
 		DateTimeParseError(dterr, str, "timestamp and time zone");
+#endif
+
+	/* a utc offset or zone abbreviation (Z included) in the input already fixes the instant */
+	has_offset = false;
+	for(i = 0; i < nf; i++)
+		if(ftype[i] == DTK_TZ || (ftype[i] == DTK_STRING && field_is_zone_abbrev(i, field[i])))
+			has_offset = true;
 
-	/* set the timezone and determine the offset for the parsed date time (which is local time) */
-	tzp = pg_tzset(tzn);
-	tz = DetermineTimeZoneOffset(tm, tzp);
+	/* otherwise set the timezone and determine the offset for the parsed date time (which is local time) */
+	tzp = tzid_to_tzp(tzid);
+	if(!has_offset)
+		tz = DetermineTimeZoneOffset(tm, tzp);
 
 	switch(dtype)
 	{
 		case DTK_DATE:
 			if(tm2timestamp(tm, fsec, &tz, &timestamp) != 0)
-				ereport(ERROR,
+				ereturn(escontext, (Datum) 0,
 					(errcode(ERRCODE_DATETIME_VALUE_OUT_OF_RANGE),
 		 			errmsg("timestamp out of range: \"%s\"", str)));
 			break;
@@ -330,11 +800,9 @@ Datum timestampandtz_in(PG_FUNCTION_ARGS)
 			break;
 
 		case DTK_INVALID:
-			ereport(ERROR,
+			ereturn(escontext, (Datum) 0,
 				(errcode(ERRCODE_FEATURE_NOT_SUPPORTED),
 				errmsg("date/time value \"%s\" is no longer supported", str)));
-			TIMESTAMP_NOEND(timestamp);
-			break;
 
 		default:
 			elog(ERROR, "unexpected dtype %d while parsing timestampandtz \"%s\"",
@@ -342,10 +810,78 @@ Datum timestampandtz_in(PG_FUNCTION_ARGS)
 			TIMESTAMP_NOEND(timestamp);
 	}
 
+	if(has_offset && dtype == DTK_DATE &&
+		!timestampandtz_check_offset(timestamp, tz, tzid, str, escontext))
+		PG_RETURN_NULL();
+
 	AdjustTimestampForTypmod(&timestamp, typmod);
 	return gen_timestamp(timestamp, tzid);
 }
 
+/* n decimal digits of value at p, zero padded, returns the end */
+static inline char *write_digits(char *p, int value, int n)
+{
+	char *end = p + n;
+
+	for(p = end; n > 0; n--, value /= 10)
+		*--p = '0' + value % 10;
+
+	return end;
+}
+
+/*
+ * The ISO DateStyle output, YYYY-MM-DD HH:MM:SS[.ffffff] @ Zone/Name, written
+ * straight into a buffer of the right size from the zone's cached offset.
+ * Returns NULL when the instant isn't covered by the transition table or the
+ * year needs more (or fewer) than four digits, EncodeDateTime handles those.
+ */
+static char *timestampandtz_out_iso(TimestampAndTz *dt)
+{
+	const struct timezone_to_id *zone;
+	Timestamp local, time;
+	int gmtoff, year, month, day, fsec;
+	char *result, *p;
+
+	if(TIMESTAMP_NOT_FINITE(dt->time) || !tzid_utc_offset(dt->tz, dt->time, &gmtoff, NULL))
+		return NULL;
+
+	local = dt->time + (Timestamp) gmtoff * USECS_PER_SEC;
+	time = local % USECS_PER_DAY;
+	if(time < 0)
+		time += USECS_PER_DAY;
+	j2date((local - time) / USECS_PER_DAY + POSTGRES_EPOCH_JDATE, &year, &month, &day);
+	if(year < 1 || year > 9999)
+		return NULL;
+
+	zone = timezones_by_id[dt->tz - 1];
+	result = p = palloc(sizeof("YYYY-MM-DD HH:MM:SS.ffffff @ ") + zone->namelen);
+
+	p = write_digits(p, year, 4);
+	*p++ = '-';
+	p = write_digits(p, month, 2);
+	*p++ = '-';
+	p = write_digits(p, day, 2);
+	*p++ = ' ';
+	p = write_digits(p, time / USECS_PER_HOUR, 2);
+	*p++ = ':';
+	p = write_digits(p, time / USECS_PER_MINUTE % MINS_PER_HOUR, 2);
+	*p++ = ':';
+	p = write_digits(p, time / USECS_PER_SEC % SECS_PER_MINUTE, 2);
+
+	/* like EncodeDateTime, no trailing zeros in the fraction */
+	if((fsec = time % USECS_PER_SEC) != 0)
+	{
+		*p++ = '.';
+		p = write_digits(p, fsec, 6);
+		while(p[-1] == '0')
+			p--;
+	}
+
+	memcpy(p, " @ ", 3);
+	memcpy(p + 3, zone->name, zone->namelen + 1);
+	return result;
+}
+
 PG_FUNCTION_INFO_V1(timestampandtz_out);
 Datum timestampandtz_out(PG_FUNCTION_ARGS)
 {
@@ -356,27 +892,34 @@ Datum timestampandtz_out(PG_FUNCTION_ARGS)
 	fsec_t fsec;
 	char buf[MAXDATELEN + 1];
 	pg_tz * tzp = NULL;
-	const char * tzname = NULL;
+	const struct timezone_to_id *zone = NULL;
+	size_t len;
 
 	/* does the argument have a valid timezone */
-	if(dt->tz != 0)
-	{
-		tzname = tzid_to_tzname(dt->tz);
-		tzp = pg_tzset(tzname);
-	}
+	if(dt->tz <= 0 || dt->tz > (int) NTIMEZONES)
+		ereport(ERROR,
+				(errcode(ERRCODE_DATA_CORRUPTED),
+				 errmsg("invalid timezone ID %d in timestampandtz", dt->tz)));
+
+	if(DateStyle == USE_ISO_DATES && (result = timestampandtz_out_iso(dt)) != NULL)
+		PG_RETURN_CSTRING(result);
+
+	zone = timezones_by_id[dt->tz - 1];
+	tzp = tzid_to_tzp(dt->tz);
 
 	if(TIMESTAMP_NOT_FINITE(dt->time))
 		TsEncodeSpecialTimestamp(dt->time, buf);
-	else if(timestamp2tm(dt->time, &tz, tm, &fsec, NULL, tzp) == 0)
+	else if(tzid_timestamp2tm(dt->time, dt->tz, &tz, tm, &fsec, tzp) == 0)
 		EncodeDateTime(tm, fsec, false, tz, NULL, DateStyle, buf);
 	else
 		ereport(ERROR, (errcode(ERRCODE_DATETIME_VALUE_OUT_OF_RANGE), errmsg("timestamp out of range")));
 
 	/* output the string format of the local time and the set timezone */
-	result = palloc0(strlen(buf) + 3 + strlen(tzname) + 1);
-	strcat(result, buf);
-	strcat(result, " @ ");
-	strcat(result, tzname);
+	len = strlen(buf);
+	result = palloc(len + 3 + zone->namelen + 1);
+	memcpy(result, buf, len);
+	memcpy(result + len, " @ ", 3);
+	memcpy(result + len + 3, zone->name, zone->namelen + 1);
 	PG_RETURN_CSTRING(result);
 }
 
@@ -391,6 +934,10 @@ Datum timestampandtz_recv(PG_FUNCTION_ARGS)
 	result = (TimestampAndTz *) palloc0(sizeof(TimestampAndTz));
 	result->time = pq_getmsgint64(buf);
 	result->tz = pq_getmsgint(buf, 2);
+	if(result->tz < 1 || result->tz > (int) NTIMEZONES)
+		ereport(ERROR,
+				(errcode(ERRCODE_INVALID_BINARY_REPRESENTATION),
+				 errmsg("invalid timezone ID %d in external timestampandtz value", result->tz)));
 
 	AdjustTimestampForTypmod(&result->time, typmod);
 	PG_RETURN_POINTER(result);
@@ -568,16 +1115,14 @@ PG_FUNCTION_INFO_V1(timestamptz_to_timestampandtz);
 Datum timestamptz_to_timestampandtz(PG_FUNCTION_ARGS)
 {
 	TimestampTz timestamp = PG_GETARG_TIMESTAMPTZ(0);
-	char *tzn;
 	int tzid;
 
 	/* find our timezone id for the current session timezone */
-	tzn = pstrdup(pg_get_timezone_name(session_timezone));
-	tzid = tzname_to_tzid(tzn);
+	tzid = session_timezone_tzid();
 
 	if(tzid == 0)
 	{
-		elog(ERROR, "missing timezone ID \"%s\"", tzn);
+		elog(ERROR, "missing timezone ID \"%s\"", pg_get_timezone_name(session_timezone));
 		return gen_timestamp(DT_NOEND, 0);
 	}
 
@@ -591,17 +1136,15 @@ Datum timestamp_to_timestampandtz(PG_FUNCTION_ARGS)
 	Timestamp result;
 	struct pg_tm tm;
 	fsec_t fsec;
-	char *tzn;
 	int tzid, tz;
 	pg_tz * tzp = NULL;
 
 	/* find our timezone id for the current session timezone */
-	tzn = pstrdup(pg_get_timezone_name(session_timezone));
-	tzid = tzname_to_tzid(tzn);
+	tzid = session_timezone_tzid();
 
 	if(tzid == 0)
 	{
-		elog(ERROR, "missing timezone ID \"%s\"", tzn);
+		elog(ERROR, "missing timezone ID \"%s\"", pg_get_timezone_name(session_timezone));
 		return gen_timestamp(DT_NOEND, 0);
 	}
 
@@ -612,7 +1155,7 @@ Datum timestamp_to_timestampandtz(PG_FUNCTION_ARGS)
 				 errmsg("timestamp out of range")));
 
 	/* get the local offset for the tm local time */
-	tzp = pg_tzset(tzn);
+	tzp = tzid_to_tzp(tzid);
 	tz = DetermineTimeZoneOffset(&tm, tzp);
 
 	/* convert from the local timezone to utc timestamp */
@@ -620,23 +1163,319 @@ Datum timestamp_to_timestampandtz(PG_FUNCTION_ARGS)
 		ereport(ERROR,
 				(errcode(ERRCODE_INVALID_PARAMETER_VALUE),
 				 errmsg("could not convert to time zone \"%s\"",
-						tzn)));
+						tzid_to_tzname(tzid))));
 
 	return gen_timestamp(result, tzid);
 }
 
+static int timestampandtz_cmp_internal(TimestampAndTz *left, TimestampAndTz *right)
+{
+	if(left->time > right->time)
+		return 1;
+	else if(left->time < right->time)
+		return -1;
+	else
+		return 0;
+}
+
 PG_FUNCTION_INFO_V1(timestampandtz_cmp);
 Datum timestampandtz_cmp(PG_FUNCTION_ARGS)
 {
 	TimestampAndTz * left = (TimestampAndTz *)PG_GETARG_POINTER(0);
 	TimestampAndTz * right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_INT32(timestampandtz_cmp_internal(left, right));
+}
 
-	if(left->time > right->time)
-		PG_RETURN_INT32(1);
-	else if(left->time < right->time)
-		PG_RETURN_INT32(-1);
+static int timestampandtz_fastcmp(Datum x, Datum y, SortSupport ssup)
+{
+	return timestampandtz_cmp_internal((TimestampAndTz *) DatumGetPointer(x), (TimestampAndTz *) DatumGetPointer(y));
+}
+
+#if SIZEOF_DATUM >= 8
+/*
+ * The abbreviated key is the whole utc time, so it orders exactly like the
+ * full comparator and only ties ever need to look at the tuple.
+ */
+static Datum timestampandtz_abbrev_convert(Datum original, SortSupport ssup)
+{
+	TimestampAndTz *dt = (TimestampAndTz *) DatumGetPointer(original);
+	return Int64GetDatum(dt->time);
+}
+
+static bool timestampandtz_abbrev_abort(int memtupcount, SortSupport ssup)
+{
+	return false;
+}
+
+#if PG_VERSION_NUM < 150000
+static int timestampandtz_abbrev_cmp(Datum x, Datum y, SortSupport ssup)
+{
+	int64 left = DatumGetInt64(x);
+	int64 right = DatumGetInt64(y);
+
+	if(left > right)
+		return 1;
+	else if(left < right)
+		return -1;
 	else
-		PG_RETURN_INT32(0);
+		return 0;
+}
+#else
+#define timestampandtz_abbrev_cmp ssup_datum_signed_cmp
+#endif
+#endif
+
+PG_FUNCTION_INFO_V1(timestampandtz_sortsupport);
+Datum timestampandtz_sortsupport(PG_FUNCTION_ARGS)
+{
+	SortSupport ssup = (SortSupport) PG_GETARG_POINTER(0);
+
+	ssup->comparator = timestampandtz_fastcmp;
+
+#if SIZEOF_DATUM >= 8
+	if(ssup->abbreviate)
+	{
+		ssup->abbrev_converter = timestampandtz_abbrev_convert;
+		ssup->abbrev_abort = timestampandtz_abbrev_abort;
+		ssup->abbrev_full_comparator = timestampandtz_fastcmp;
+		ssup->comparator = timestampandtz_abbrev_cmp;
+	}
+#endif
+
+	PG_RETURN_VOID();
+}
+
+/*
+ * Local wall clock ordering for timestampandtz_local_ops, the same local time
+ * in different offsets is equal.  The date operators compare the local time
+ * against midnight of the date, so they belong to this family rather than the
+ * utc one, and breaking ties by utc would make ~=~ disagree with them.
+ */
+static int timestampandtz_local_cmp_internal(TimestampAndTz *left, TimestampAndTz *right)
+{
+	return timestamp_cmp_internal(tolocal(left), tolocal(right));
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_local_eq);
+Datum timestampandtz_local_eq(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_BOOL(timestampandtz_local_cmp_internal(left, right) == 0);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_local_ne);
+Datum timestampandtz_local_ne(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_BOOL(timestampandtz_local_cmp_internal(left, right) != 0);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_local_lt);
+Datum timestampandtz_local_lt(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_BOOL(timestampandtz_local_cmp_internal(left, right) < 0);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_local_le);
+Datum timestampandtz_local_le(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_BOOL(timestampandtz_local_cmp_internal(left, right) <= 0);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_local_gt);
+Datum timestampandtz_local_gt(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_BOOL(timestampandtz_local_cmp_internal(left, right) > 0);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_local_ge);
+Datum timestampandtz_local_ge(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_BOOL(timestampandtz_local_cmp_internal(left, right) >= 0);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_local_cmp);
+Datum timestampandtz_local_cmp(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_INT32(timestampandtz_local_cmp_internal(left, right));
+}
+
+static int timestampandtz_local_fastcmp(Datum x, Datum y, SortSupport ssup)
+{
+	return timestampandtz_local_cmp_internal((TimestampAndTz *) DatumGetPointer(x), (TimestampAndTz *) DatumGetPointer(y));
+}
+
+#if SIZEOF_DATUM >= 8
+/* the abbreviated key is the whole local time, so equal keys are equal */
+static Datum timestampandtz_local_abbrev_convert(Datum original, SortSupport ssup)
+{
+	return Int64GetDatum(tolocal((TimestampAndTz *) DatumGetPointer(original)));
+}
+#endif
+
+PG_FUNCTION_INFO_V1(timestampandtz_local_sortsupport);
+Datum timestampandtz_local_sortsupport(PG_FUNCTION_ARGS)
+{
+	SortSupport ssup = (SortSupport) PG_GETARG_POINTER(0);
+
+	ssup->comparator = timestampandtz_local_fastcmp;
+
+#if SIZEOF_DATUM >= 8
+	if(ssup->abbreviate)
+	{
+		ssup->abbrev_converter = timestampandtz_local_abbrev_convert;
+		ssup->abbrev_abort = timestampandtz_abbrev_abort;
+		ssup->abbrev_full_comparator = timestampandtz_local_fastcmp;
+		ssup->comparator = timestampandtz_abbrev_cmp;
+	}
+#endif
+
+	PG_RETURN_VOID();
+}
+
+/*
+ * (utc time, zone id) ordering for timestampandtz_image_ops.  Values equal
+ * here are the same bytes, so btree can deduplicate them.
+ */
+static int timestampandtz_image_cmp_internal(TimestampAndTz *left, TimestampAndTz *right)
+{
+	int cmp = timestampandtz_cmp_internal(left, right);
+
+	if(cmp != 0)
+		return cmp;
+	else if(left->tz > right->tz)
+		return 1;
+	else if(left->tz < right->tz)
+		return -1;
+	else
+		return 0;
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_image_eq);
+Datum timestampandtz_image_eq(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_BOOL(timestampandtz_image_cmp_internal(left, right) == 0);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_image_ne);
+Datum timestampandtz_image_ne(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_BOOL(timestampandtz_image_cmp_internal(left, right) != 0);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_image_lt);
+Datum timestampandtz_image_lt(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_BOOL(timestampandtz_image_cmp_internal(left, right) < 0);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_image_le);
+Datum timestampandtz_image_le(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_BOOL(timestampandtz_image_cmp_internal(left, right) <= 0);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_image_gt);
+Datum timestampandtz_image_gt(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_BOOL(timestampandtz_image_cmp_internal(left, right) > 0);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_image_ge);
+Datum timestampandtz_image_ge(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_BOOL(timestampandtz_image_cmp_internal(left, right) >= 0);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_image_cmp);
+Datum timestampandtz_image_cmp(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_INT32(timestampandtz_image_cmp_internal(left, right));
+}
+
+static int timestampandtz_image_fastcmp(Datum x, Datum y, SortSupport ssup)
+{
+	return timestampandtz_image_cmp_internal((TimestampAndTz *) DatumGetPointer(x), (TimestampAndTz *) DatumGetPointer(y));
+}
+
+/* same abbreviated key as the utc order, the zone only matters on ties */
+PG_FUNCTION_INFO_V1(timestampandtz_image_sortsupport);
+Datum timestampandtz_image_sortsupport(PG_FUNCTION_ARGS)
+{
+	SortSupport ssup = (SortSupport) PG_GETARG_POINTER(0);
+
+	ssup->comparator = timestampandtz_image_fastcmp;
+
+#if SIZEOF_DATUM >= 8
+	if(ssup->abbreviate)
+	{
+		ssup->abbrev_converter = timestampandtz_abbrev_convert;
+		ssup->abbrev_abort = timestampandtz_abbrev_abort;
+		ssup->abbrev_full_comparator = timestampandtz_image_fastcmp;
+		ssup->comparator = timestampandtz_abbrev_cmp;
+	}
+#endif
+
+	PG_RETURN_VOID();
+}
+
+/* distance between two values for brin minmax-multi, in utc microseconds */
+PG_FUNCTION_INFO_V1(timestampandtz_brin_minmax_multi_distance);
+Datum timestampandtz_brin_minmax_multi_distance(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *dt1 = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampAndTz *dt2 = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_FLOAT8((float8) dt2->time - (float8) dt1->time);
+}
+
+/* subtype_diff of timestampandtzrange, seconds of utc time like tstz_subdiff */
+PG_FUNCTION_INFO_V1(timestampandtz_subdiff);
+Datum timestampandtz_subdiff(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *dt1 = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampAndTz *dt2 = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_FLOAT8(((float8) dt1->time - (float8) dt2->time) / USECS_PER_SEC);
+}
+
+/* hashes only the utc time so values equal under timestampandtz_eq hash the same */
+PG_FUNCTION_INFO_V1(timestampandtz_hash);
+Datum timestampandtz_hash(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *dt = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	return DirectFunctionCall1(hashint8, Int64GetDatumFast(dt->time));
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_hash_extended);
+Datum timestampandtz_hash_extended(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *dt = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	return DirectFunctionCall2(hashint8extended, Int64GetDatumFast(dt->time), PG_GETARG_DATUM(1));
 }
 
 PG_FUNCTION_INFO_V1(timestampandtz_pl_interval);
@@ -656,14 +1495,14 @@ Datum timestampandtz_pl_interval(PG_FUNCTION_ARGS)
 	else
 	{
 		tzname = tzid_to_tzname(dt->tz);
-		tzp = pg_tzset(tzname);
+		tzp = tzid_to_tzp(dt->tz);
 
 		if (span->month != 0)
 		{
 			struct pg_tm tt, *tm = &tt;
 			fsec_t fsec;
 
-			if (timestamp2tm(timestamp, &tz, tm, &fsec, NULL, tzp) != 0)
+			if (tzid_timestamp2tm(timestamp, dt->tz, &tz, tm, &fsec, tzp) != 0)
 				ereport(ERROR,
 						(errcode(ERRCODE_DATETIME_VALUE_OUT_OF_RANGE),
 						 errmsg("timestamp out of range")));
@@ -700,7 +1539,7 @@ Datum timestampandtz_pl_interval(PG_FUNCTION_ARGS)
 			fsec_t		fsec;
 			int			julian;
 
-			if (timestamp2tm(timestamp, &tz, tm, &fsec, NULL, tzp) != 0)
+			if (tzid_timestamp2tm(timestamp, dt->tz, &tz, tm, &fsec, tzp) != 0)
 				ereport(ERROR,
 						(errcode(ERRCODE_DATETIME_VALUE_OUT_OF_RANGE),
 						 errmsg("timestamp out of range")));
@@ -781,6 +1620,49 @@ Datum timestampandtz_mi(PG_FUNCTION_ARGS)
 	PG_RETURN_INTERVAL_P(result);
 }
 
+/*
+ * in_range for RANGE window frames.  The frame moves along the utc order of
+ * the btree class, so the bound is worked out on the utc time in the session
+ * zone, exactly like timestamptz, and not in each row's own zone.
+ */
+PG_FUNCTION_INFO_V1(in_range_timestampandtz_interval);
+Datum in_range_timestampandtz_interval(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *val = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampAndTz *base = (TimestampAndTz *)PG_GETARG_POINTER(1);
+
+	return DirectFunctionCall5(in_range_timestamptz_interval,
+		TimestampTzGetDatum(val->time), TimestampTzGetDatum(base->time),
+		PG_GETARG_DATUM(2), PG_GETARG_DATUM(3), PG_GETARG_DATUM(4));
+}
+
+/* absolute difference of the utc times, the distance of nearest-in-time scans */
+PG_FUNCTION_INFO_V1(timestampandtz_distance);
+Datum timestampandtz_distance(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	Interval   *result;
+
+	result = (Interval *) palloc(sizeof(Interval));
+
+	/* anything infinite is as far away as an interval can say */
+	if (TIMESTAMP_NOT_FINITE(left->time) || TIMESTAMP_NOT_FINITE(right->time))
+	{
+		result->time = PG_INT64_MAX;
+		result->month = PG_INT32_MAX;
+		result->day = PG_INT32_MAX;
+		PG_RETURN_INTERVAL_P(result);
+	}
+
+	result->time = left->time > right->time ? left->time - right->time : right->time - left->time;
+	result->month = 0;
+	result->day = 0;
+
+	result = DatumGetIntervalP(DirectFunctionCall1(interval_justify_hours, IntervalPGetDatum(result)));
+	PG_RETURN_INTERVAL_P(result);
+}
+
 PG_FUNCTION_INFO_V1(timestampandtz_trunc);
 Datum timestampandtz_trunc(PG_FUNCTION_ARGS)
 {
@@ -799,7 +1681,7 @@ Datum timestampandtz_trunc(PG_FUNCTION_ARGS)
 		return gen_timestamp(DT_NOEND, 0);
 
 	tzname = tzid_to_tzname(dt->tz);
-	tzp = pg_tzset(tzname);
+	tzp = tzid_to_tzp(dt->tz);
 
 	lowunits = downcase_truncate_identifier(VARDATA_ANY(units),
 											VARSIZE_ANY_EXHDR(units),
@@ -809,7 +1691,7 @@ Datum timestampandtz_trunc(PG_FUNCTION_ARGS)
 
 	if (type == UNITS)
 	{
-		if (timestamp2tm(dt->time, &tz, tm, &fsec, NULL, tzp) != 0)
+		if (tzid_timestamp2tm(dt->time, dt->tz, &tz, tm, &fsec, tzp) != 0)
 			ereport(ERROR,
 					(errcode(ERRCODE_DATETIME_VALUE_OUT_OF_RANGE),
 					 errmsg("timestamp out of range")));
@@ -989,11 +1871,11 @@ Datum timestampandtz_trunc_at(PG_FUNCTION_ARGS)
 		elog(ERROR, "missing timezone ID \"%s\"", target_tzname);
 		return gen_timestamp(DT_NOEND, 0);
 	}
-	target_tzp = pg_tzset(target_tzname);
+	target_tzp = tzid_to_tzp(target_tzid);
 
 	/* find the source timezone id */
 	source_tzname = tzid_to_tzname(dt->tz);
-	source_tzp = pg_tzset(source_tzname);
+	source_tzp = tzid_to_tzp(dt->tz);
 
 	lowunits = downcase_truncate_identifier(VARDATA_ANY(units),
 											VARSIZE_ANY_EXHDR(units),
@@ -1004,7 +1886,7 @@ Datum timestampandtz_trunc_at(PG_FUNCTION_ARGS)
 	if (type == UNITS)
 	{
 		/* get the tm time for the time in the target timezone : UTC -> target */
-		if (timestamp2tm(dt->time, &tz, tm, &fsec, NULL, target_tzp) != 0)
+		if (tzid_timestamp2tm(dt->time, target_tzid, &tz, tm, &fsec, target_tzp) != 0)
 			ereport(ERROR,
 					(errcode(ERRCODE_DATETIME_VALUE_OUT_OF_RANGE),
 					 errmsg("timestamp out of range")));
@@ -1153,7 +2035,7 @@ Datum timestampandtz_part(PG_FUNCTION_ARGS)
 	}
 
 	tzname = tzid_to_tzname(dt->tz);
-	tzp = pg_tzset(tzname);
+	tzp = tzid_to_tzp(dt->tz);
 
 	lowunits = downcase_truncate_identifier(VARDATA_ANY(units),
 											VARSIZE_ANY_EXHDR(units),
@@ -1165,7 +2047,7 @@ Datum timestampandtz_part(PG_FUNCTION_ARGS)
 
 	if (type == UNITS)
 	{
-		if (timestamp2tm(timestamp, &tz, tm, &fsec, NULL, tzp) != 0)
+		if (tzid_timestamp2tm(timestamp, dt->tz, &tz, tm, &fsec, tzp) != 0)
 			ereport(ERROR,
 					(errcode(ERRCODE_DATETIME_VALUE_OUT_OF_RANGE),
 					 errmsg("timestamp out of range")));
@@ -1305,7 +2187,7 @@ Datum timestampandtz_part(PG_FUNCTION_ARGS)
 
 			case DTK_DOW:
 			case DTK_ISODOW:
-				if (timestamp2tm(timestamp, &tz, tm, &fsec, NULL, tzp) != 0)
+				if (tzid_timestamp2tm(timestamp, dt->tz, &tz, tm, &fsec, tzp) != 0)
 					ereport(ERROR,
 							(errcode(ERRCODE_DATETIME_VALUE_OUT_OF_RANGE),
 							 errmsg("timestamp out of range")));
@@ -1315,7 +2197,7 @@ Datum timestampandtz_part(PG_FUNCTION_ARGS)
 				break;
 
 			case DTK_DOY:
-				if (timestamp2tm(timestamp, &tz, tm, &fsec, NULL, tzp) != 0)
+				if (tzid_timestamp2tm(timestamp, dt->tz, &tz, tm, &fsec, tzp) != 0)
 					ereport(ERROR,
 							(errcode(ERRCODE_DATETIME_VALUE_OUT_OF_RANGE),
 							 errmsg("timestamp out of range")));
@@ -1455,16 +2337,213 @@ Datum timestampandtz_cmp_date(PG_FUNCTION_ARGS)
 	PG_RETURN_INT32(timestamp_cmp_internal(tolocal(dt1), dt2));
 }
 
+PG_FUNCTION_INFO_V1(date_eq_timestampandtz);
+Datum date_eq_timestampandtz(PG_FUNCTION_ARGS)
+{
+	DateADT		dateVal = PG_GETARG_DATEADT(0);
+	TimestampAndTz *dt2 = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	Timestamp	dt1;
+
+	dt1 = date2timestamp(dateVal);
+
+	PG_RETURN_BOOL(timestamp_cmp_internal(dt1, tolocal(dt2)) == 0);
+}
+
+PG_FUNCTION_INFO_V1(date_ne_timestampandtz);
+Datum date_ne_timestampandtz(PG_FUNCTION_ARGS)
+{
+	DateADT		dateVal = PG_GETARG_DATEADT(0);
+	TimestampAndTz *dt2 = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	Timestamp	dt1;
+
+	dt1 = date2timestamp(dateVal);
+
+	PG_RETURN_BOOL(timestamp_cmp_internal(dt1, tolocal(dt2)) != 0);
+}
+
+PG_FUNCTION_INFO_V1(date_lt_timestampandtz);
+Datum date_lt_timestampandtz(PG_FUNCTION_ARGS)
+{
+	DateADT		dateVal = PG_GETARG_DATEADT(0);
+	TimestampAndTz *dt2 = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	Timestamp	dt1;
+
+	dt1 = date2timestamp(dateVal);
+
+	PG_RETURN_BOOL(timestamp_cmp_internal(dt1, tolocal(dt2)) < 0);
+}
+
+PG_FUNCTION_INFO_V1(date_gt_timestampandtz);
+Datum date_gt_timestampandtz(PG_FUNCTION_ARGS)
+{
+	DateADT		dateVal = PG_GETARG_DATEADT(0);
+	TimestampAndTz *dt2 = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	Timestamp	dt1;
+
+	dt1 = date2timestamp(dateVal);
+
+	PG_RETURN_BOOL(timestamp_cmp_internal(dt1, tolocal(dt2)) > 0);
+}
+
+PG_FUNCTION_INFO_V1(date_le_timestampandtz);
+Datum date_le_timestampandtz(PG_FUNCTION_ARGS)
+{
+	DateADT		dateVal = PG_GETARG_DATEADT(0);
+	TimestampAndTz *dt2 = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	Timestamp	dt1;
+
+	dt1 = date2timestamp(dateVal);
+
+	PG_RETURN_BOOL(timestamp_cmp_internal(dt1, tolocal(dt2)) <= 0);
+}
+
+PG_FUNCTION_INFO_V1(date_ge_timestampandtz);
+Datum date_ge_timestampandtz(PG_FUNCTION_ARGS)
+{
+	DateADT		dateVal = PG_GETARG_DATEADT(0);
+	TimestampAndTz *dt2 = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	Timestamp	dt1;
+
+	dt1 = date2timestamp(dateVal);
+
+	PG_RETURN_BOOL(timestamp_cmp_internal(dt1, tolocal(dt2)) >= 0);
+}
+
+PG_FUNCTION_INFO_V1(date_cmp_timestampandtz);
+Datum date_cmp_timestampandtz(PG_FUNCTION_ARGS)
+{
+	DateADT		dateVal = PG_GETARG_DATEADT(0);
+	TimestampAndTz *dt2 = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	Timestamp	dt1;
+
+	dt1 = date2timestamp(dateVal);
+
+	PG_RETURN_INT32(timestamp_cmp_internal(dt1, tolocal(dt2)));
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_eq_timestamptz);
+Datum timestampandtz_eq_timestamptz(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampTz right = PG_GETARG_TIMESTAMPTZ(1);
+	PG_RETURN_BOOL(left->time == right);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_ne_timestamptz);
+Datum timestampandtz_ne_timestamptz(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampTz right = PG_GETARG_TIMESTAMPTZ(1);
+	PG_RETURN_BOOL(left->time != right);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_lt_timestamptz);
+Datum timestampandtz_lt_timestamptz(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampTz right = PG_GETARG_TIMESTAMPTZ(1);
+	PG_RETURN_BOOL(left->time < right);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_le_timestamptz);
+Datum timestampandtz_le_timestamptz(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampTz right = PG_GETARG_TIMESTAMPTZ(1);
+	PG_RETURN_BOOL(left->time <= right);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_gt_timestamptz);
+Datum timestampandtz_gt_timestamptz(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampTz right = PG_GETARG_TIMESTAMPTZ(1);
+	PG_RETURN_BOOL(left->time > right);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_ge_timestamptz);
+Datum timestampandtz_ge_timestamptz(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampTz right = PG_GETARG_TIMESTAMPTZ(1);
+	PG_RETURN_BOOL(left->time >= right);
+}
+
+PG_FUNCTION_INFO_V1(timestampandtz_cmp_timestamptz);
+Datum timestampandtz_cmp_timestamptz(PG_FUNCTION_ARGS)
+{
+	TimestampAndTz *left = (TimestampAndTz *)PG_GETARG_POINTER(0);
+	TimestampTz right = PG_GETARG_TIMESTAMPTZ(1);
+	PG_RETURN_INT32(timestamp_cmp_internal(left->time, right));
+}
+
+PG_FUNCTION_INFO_V1(timestamptz_eq_timestampandtz);
+Datum timestamptz_eq_timestampandtz(PG_FUNCTION_ARGS)
+{
+	TimestampTz left = PG_GETARG_TIMESTAMPTZ(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_BOOL(left == right->time);
+}
+
+PG_FUNCTION_INFO_V1(timestamptz_ne_timestampandtz);
+Datum timestamptz_ne_timestampandtz(PG_FUNCTION_ARGS)
+{
+	TimestampTz left = PG_GETARG_TIMESTAMPTZ(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_BOOL(left != right->time);
+}
+
+PG_FUNCTION_INFO_V1(timestamptz_lt_timestampandtz);
+Datum timestamptz_lt_timestampandtz(PG_FUNCTION_ARGS)
+{
+	TimestampTz left = PG_GETARG_TIMESTAMPTZ(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_BOOL(left < right->time);
+}
+
+PG_FUNCTION_INFO_V1(timestamptz_le_timestampandtz);
+Datum timestamptz_le_timestampandtz(PG_FUNCTION_ARGS)
+{
+	TimestampTz left = PG_GETARG_TIMESTAMPTZ(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_BOOL(left <= right->time);
+}
+
+PG_FUNCTION_INFO_V1(timestamptz_gt_timestampandtz);
+Datum timestamptz_gt_timestampandtz(PG_FUNCTION_ARGS)
+{
+	TimestampTz left = PG_GETARG_TIMESTAMPTZ(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_BOOL(left > right->time);
+}
+
+PG_FUNCTION_INFO_V1(timestamptz_ge_timestampandtz);
+Datum timestamptz_ge_timestampandtz(PG_FUNCTION_ARGS)
+{
+	TimestampTz left = PG_GETARG_TIMESTAMPTZ(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_BOOL(left >= right->time);
+}
+
+PG_FUNCTION_INFO_V1(timestamptz_cmp_timestampandtz);
+Datum timestamptz_cmp_timestampandtz(PG_FUNCTION_ARGS)
+{
+	TimestampTz left = PG_GETARG_TIMESTAMPTZ(0);
+	TimestampAndTz *right = (TimestampAndTz *)PG_GETARG_POINTER(1);
+	PG_RETURN_INT32(timestamp_cmp_internal(left, right->time));
+}
+
 PG_FUNCTION_INFO_V1(timestampandtz_smaller);
 Datum timestampandtz_smaller(PG_FUNCTION_ARGS)
 {
 	TimestampAndTz *dt1 = (TimestampAndTz *)PG_GETARG_POINTER(0);
 	TimestampAndTz *dt2 = (TimestampAndTz *)PG_GETARG_POINTER(1);
 
-	if(timestamp_cmp_internal(dt1->time, dt2->time) < 0)
-		return gen_timestamp(dt1->time, dt1->tz);
+	/* return the winning input as is, nodeAgg copies it into the aggregate context */
+	if(timestampandtz_cmp_internal(dt1, dt2) < 0)
+		PG_RETURN_DATUM(PG_GETARG_DATUM(0));
 	else
-		return gen_timestamp(dt2->time, dt2->tz);
+		PG_RETURN_DATUM(PG_GETARG_DATUM(1));
 }
 
 PG_FUNCTION_INFO_V1(timestampandtz_larger);
@@ -1473,8 +2552,8 @@ Datum timestampandtz_larger(PG_FUNCTION_ARGS)
 	TimestampAndTz *dt1 = (TimestampAndTz *)PG_GETARG_POINTER(0);
 	TimestampAndTz *dt2 = (TimestampAndTz *)PG_GETARG_POINTER(1);
 
-	if(timestamp_cmp_internal(dt1->time, dt2->time) > 0)
-		return gen_timestamp(dt1->time, dt1->tz);
+	if(timestampandtz_cmp_internal(dt1, dt2) > 0)
+		PG_RETURN_DATUM(PG_GETARG_DATUM(0));
 	else
-		return gen_timestamp(dt2->time, dt2->tz);
+		PG_RETURN_DATUM(PG_GETARG_DATUM(1));
 }
@@ -11,13 +11,18 @@
 #include <wctype.h>
 #endif
 
+#include "access/hash.h"
 #include "catalog/pg_collation.h"
+#if PG_VERSION_NUM >= 130000
+#include "common/hashfn.h"
+#endif
 #include "mb/pg_wchar.h"
 #include "utils/builtins.h"
 #include "utils/date.h"
 #include "utils/datetime.h"
 #include "utils/formatting.h"
 #include "utils/int8.h"
+#include "utils/memutils.h"
 #include "utils/numeric.h"
 #include "utils/pg_locale.h"
 
@@ -292,30 +297,32 @@ typedef struct
 #define IS_EEEE(_f)		((_f)->flag & NUM_F_EEEE)
 
 /* ----------
- * Format picture cache
- *	(cache size:
- *		Number part = NUM_CACHE_SIZE * NUM_CACHE_FIELDS
- *		Date-time part	= DCH_CACHE_SIZE * DCH_CACHE_FIELDS
- *	)
+ * Compiled format pictures
+ *
+ * A format is parsed once into a DCHProgram.  The program of the format a
+ * call site last used is kept in its fn_extra, formats that change from row
+ * to row go through a small backend-wide table keyed by a hash of the format
+ * (a collision just replaces the older program).
  * ----------
  */
-#define NUM_CACHE_SIZE		64
-#define NUM_CACHE_FIELDS	16
-#define DCH_CACHE_SIZE		128
-#define DCH_CACHE_FIELDS	16
+#define DCH_PROGRAM_SLOTS	64		/* power of 2 */
 
 typedef struct
 {
-	FormatNode	format[DCH_CACHE_SIZE + 1];
-	char		str[DCH_CACHE_SIZE + 1];
-	int			age;
-} DCHCacheEntry;
+	int			fmt_len;		/* bytes in the format picture */
+	int			max_len;		/* longest output, without the terminator */
+	char	   *fmt;			/* the format picture, not terminated */
+	FormatNode	format[FLEXIBLE_ARRAY_MEMBER];
+} DCHProgram;
 
-/* global cache for --- date/time part */
-static DCHCacheEntry DCHCache[DCH_CACHE_FIELDS + 1];
+typedef struct
+{
+	DCHProgram *program;		/* allocated in fn_mcxt */
+	bool		varying;		/* the format changed, use the backend table */
+} DCHCallCache;
 
-static int	n_DCHCache = 0;		/* number of entries */
-static int	DCHCounter = 0;
+static MemoryContext DCHProgramContext = NULL;
+static DCHProgram *DCHPrograms[DCH_PROGRAM_SLOTS];
 
 /* ----------
  * For char->date/time conversion
@@ -881,8 +888,9 @@ static void dump_node(FormatNode *node, int max);
 
 static const char *get_th(char *num, int type);
 static char *str_numth(char *dest, char *num, int type);
-static DCHCacheEntry *DCH_cache_search(char *str);
-static DCHCacheEntry *DCH_cache_getnew(char *str);
+static DCHProgram *DCH_compile(const char *fmt, int fmt_len, MemoryContext mcxt);
+static DCHProgram *DCH_program_lookup(const char *fmt, int fmt_len);
+static DCHProgram *DCH_program_for_call(FunctionCallInfo fcinfo, const char *fmt, int fmt_len);
 
 /* ----------
  * Fast sequential search, use index for data selection which
@@ -2199,167 +2207,113 @@ DCH_to_char(FormatNode *node, bool is_interval, TmToChar *in, char *out, Oid col
 	*s = '\0';
 }
 
-static DCHCacheEntry *
-DCH_cache_getnew(char *str)
+/*
+ * Parse a format picture into a program allocated in mcxt.  The parse runs in
+ * the current context first, so an error in it leaves nothing behind in mcxt.
+ */
+static DCHProgram *
+DCH_compile(const char *fmt, int fmt_len, MemoryContext mcxt)
 {
-	DCHCacheEntry *ent;
+	FormatNode *format;
+	DCHProgram *prog;
+	char	   *fmt_str;
 
-	/* counter overflow check - paranoia? */
-	if (DCHCounter >= (INT_MAX - DCH_CACHE_FIELDS - 1))
-	{
-		DCHCounter = 0;
+	fmt_str = pnstrdup(fmt, fmt_len);
+	format = (FormatNode *) palloc((fmt_len + 1) * sizeof(FormatNode));
 
-		for (ent = DCHCache; ent <= (DCHCache + DCH_CACHE_FIELDS); ent++)
-			ent->age = (++DCHCounter);
-	}
+	parse_format(format, fmt_str, DCH_keywords,
+				 DCH_suff, DCH_index, DCH_TYPE, NULL);
 
-	/*
-	 * If cache is full, remove oldest entry
-	 */
-	if (n_DCHCache > DCH_CACHE_FIELDS)
-	{
-		DCHCacheEntry *old = DCHCache + 0;
+	(format + fmt_len)->type = NODE_TYPE_END;	/* Paranoia? */
 
-#ifdef DEBUG_TO_FROM_CHAR
-		elog(DEBUG_elog_output, "cache is full (%d)", n_DCHCache);
-#endif
-		for (ent = DCHCache + 1; ent <= (DCHCache + DCH_CACHE_FIELDS); ent++)
-		{
-			if (ent->age < old->age)
-				old = ent;
-		}
-#ifdef DEBUG_TO_FROM_CHAR
-		elog(DEBUG_elog_output, "OLD: '%s' AGE: %d", old->str, old->age);
-#endif
-		StrNCpy(old->str, str, DCH_CACHE_SIZE + 1);
-		/* old->format fill parser */
-		old->age = (++DCHCounter);
-		return old;
-	}
-	else
-	{
-#ifdef DEBUG_TO_FROM_CHAR
-		elog(DEBUG_elog_output, "NEW (%d)", n_DCHCache);
-#endif
-		ent = DCHCache + n_DCHCache;
-		StrNCpy(ent->str, str, DCH_CACHE_SIZE + 1);
-		/* ent->format fill parser */
-		ent->age = (++DCHCounter);
-		++n_DCHCache;
-		return ent;
-	}
+	prog = (DCHProgram *) MemoryContextAlloc(mcxt, offsetof(DCHProgram, format) +
+											 (fmt_len + 1) * sizeof(FormatNode) + fmt_len);
+	prog->fmt_len = fmt_len;
+	prog->max_len = fmt_len * DCH_MAX_ITEM_SIZ;
+	prog->fmt = (char *) (prog->format + fmt_len + 1);
+	memcpy(prog->format, format, (fmt_len + 1) * sizeof(FormatNode));
+	memcpy(prog->fmt, fmt, fmt_len);
+
+	pfree(format);
+	pfree(fmt_str);
+	return prog;
 }
 
-static DCHCacheEntry *
-DCH_cache_search(char *str)
+static inline bool
+DCH_program_matches(DCHProgram *prog, const char *fmt, int fmt_len)
 {
-	int			i;
-	DCHCacheEntry *ent;
+	return prog->fmt_len == fmt_len && memcmp(prog->fmt, fmt, fmt_len) == 0;
+}
 
-	/* counter overflow check - paranoia? */
-	if (DCHCounter >= (INT_MAX - DCH_CACHE_FIELDS - 1))
-	{
-		DCHCounter = 0;
+static DCHProgram *
+DCH_program_lookup(const char *fmt, int fmt_len)
+{
+	uint32		h = DatumGetUInt32(hash_any((const unsigned char *) fmt, fmt_len));
+	DCHProgram **slot = &DCHPrograms[h & (DCH_PROGRAM_SLOTS - 1)];
+	DCHProgram *prog;
+
+	if (*slot != NULL && DCH_program_matches(*slot, fmt, fmt_len))
+		return *slot;
+
+	if (DCHProgramContext == NULL)
+		DCHProgramContext = AllocSetContextCreate(TopMemoryContext,
+												  "timestampandtz to_char formats",
+												  ALLOCSET_SMALL_SIZES);
+
+	prog = DCH_compile(fmt, fmt_len, DCHProgramContext);
+	if (*slot != NULL)
+		pfree(*slot);
+	*slot = prog;
+	return prog;
+}
 
-		for (ent = DCHCache; ent <= (DCHCache + DCH_CACHE_FIELDS); ent++)
-			ent->age = (++DCHCounter);
+/*
+ * The program for this call's format.  Once a call site sees a second format
+ * it stops checking fn_extra, so varying formats don't allocate there per row.
+ */
+static DCHProgram *
+DCH_program_for_call(FunctionCallInfo fcinfo, const char *fmt, int fmt_len)
+{
+	FmgrInfo   *flinfo = fcinfo->flinfo;
+	DCHCallCache *cache;
+
+	if (flinfo == NULL)
+		return DCH_program_lookup(fmt, fmt_len);
+
+	cache = (DCHCallCache *) flinfo->fn_extra;
+	if (cache == NULL)
+	{
+		cache = (DCHCallCache *) MemoryContextAllocZero(flinfo->fn_mcxt, sizeof(DCHCallCache));
+		cache->program = DCH_compile(fmt, fmt_len, flinfo->fn_mcxt);
+		flinfo->fn_extra = cache;
+		return cache->program;
 	}
 
-	for (i = 0, ent = DCHCache; i < n_DCHCache; i++, ent++)
+	if (!cache->varying)
 	{
-		if (strcmp(ent->str, str) == 0)
-		{
-			ent->age = (++DCHCounter);
-			return ent;
-		}
+		if (DCH_program_matches(cache->program, fmt, fmt_len))
+			return cache->program;
+		cache->varying = true;
 	}
 
-	return NULL;
+	return DCH_program_lookup(fmt, fmt_len);
 }
 
 /*
- * Format a date/time or interval into a string according to fmt.
- * We parse fmt into a list of FormatNodes.  This is then passed to DCH_to_char
- * for formatting.
+ * Format a date/time or interval into a string according to a compiled
+ * format, written straight into a text big enough for any output of it.
  */
 static text *
-datetime_to_char_body(TmToChar *tmtc, text *fmt, bool is_interval, Oid collid)
+datetime_to_char_body(TmToChar *tmtc, DCHProgram *prog, bool is_interval, Oid collid)
 {
-	FormatNode *format;
-	char	   *fmt_str,
-			   *result;
-	bool		incache;
-	int			fmt_len;
 	text	   *res;
 
-	/*
-	 * Convert fmt to C string
-	 */
-	fmt_str = text_to_cstring(fmt);
-	fmt_len = strlen(fmt_str);
-
-	/*
-	 * Allocate workspace for result as C string
-	 */
-	result = palloc((fmt_len * DCH_MAX_ITEM_SIZ) + 1);
-	*result = '\0';
-
-	/*
-	 * Allocate new memory if format picture is bigger than static cache and
-	 * not use cache (call parser always)
-	 */
-	if (fmt_len > DCH_CACHE_SIZE)
-	{
-		format = (FormatNode *) palloc((fmt_len + 1) * sizeof(FormatNode));
-		incache = FALSE;
-
-		parse_format(format, fmt_str, DCH_keywords,
-					 DCH_suff, DCH_index, DCH_TYPE, NULL);
-
-		(format + fmt_len)->type = NODE_TYPE_END;		/* Paranoia? */
-	}
-	else
-	{
-		/*
-		 * Use cache buffers
-		 */
-		DCHCacheEntry *ent;
-
-		incache = TRUE;
-
-		if ((ent = DCH_cache_search(fmt_str)) == NULL)
-		{
-			ent = DCH_cache_getnew(fmt_str);
-
-			/*
-			 * Not in the cache, must run parser and save a new format-picture
-			 * to the cache.
-			 */
-			parse_format(ent->format, fmt_str, DCH_keywords,
-						 DCH_suff, DCH_index, DCH_TYPE, NULL);
-
-			(ent->format + fmt_len)->type = NODE_TYPE_END;		/* Paranoia? */
-
-#ifdef DEBUG_TO_FROM_CHAR
-			/* dump_node(ent->format, fmt_len); */
-			/* dump_index(DCH_keywords, DCH_index);  */
-#endif
-		}
-		format = ent->format;
-	}
+	res = (text *) palloc(VARHDRSZ + prog->max_len + 1);
 
 	/* The real work is here */
-	DCH_to_char(format, is_interval, tmtc, result, collid);
-
-	if (!incache)
-		pfree(format);
-
-	pfree(fmt_str);
-
-	/* convert C-string result to TEXT format */
-	res = cstring_to_text(result);
+	DCH_to_char(prog->format, is_interval, tmtc, VARDATA(res), collid);
 
-	pfree(result);
+	SET_VARSIZE(res, VARHDRSZ + strlen(VARDATA(res)));
 	return res;
 }
 
@@ -2370,7 +2324,8 @@ PG_FUNCTION_INFO_V1(timestampandtz_to_char);
 Datum timestampandtz_to_char(PG_FUNCTION_ARGS)
 {
 	TimestampAndTz *dt = (TimestampAndTz *)PG_GETARG_POINTER(0);
-	text *fmt = PG_GETARG_TEXT_P(1), *res;
+	text *fmt = PG_GETARG_TEXT_PP(1), *res;
+	DCHProgram *prog;
 	TmToChar tmtc;
 	int tz;
 	struct pg_tm *tm;
@@ -2378,14 +2333,14 @@ Datum timestampandtz_to_char(PG_FUNCTION_ARGS)
 	pg_tz * tzp = NULL;
 	const char * tzname = NULL;
 
-	if ((VARSIZE(fmt) - VARHDRSZ) <= 0 || TIMESTAMP_NOT_FINITE(dt->time))
+	if (VARSIZE_ANY_EXHDR(fmt) <= 0 || TIMESTAMP_NOT_FINITE(dt->time))
 		PG_RETURN_NULL();
 
 	/* does the argument have a valid timezone */
 	if(dt->tz != 0)
 	{
 		tzname = tzid_to_tzname(dt->tz);
-		tzp = pg_tzset(tzname);
+		tzp = tzid_to_tzp(dt->tz);
 	}
 	else
 	{
@@ -2404,7 +2359,8 @@ Datum timestampandtz_to_char(PG_FUNCTION_ARGS)
 	tm->tm_wday = (thisdate + 1) % 7;
 	tm->tm_yday = thisdate - date2j(tm->tm_year, 1, 1) + 1;
 
-	if (!(res = datetime_to_char_body(&tmtc, fmt, false, PG_GET_COLLATION())))
+	prog = DCH_program_for_call(fcinfo, VARDATA_ANY(fmt), VARSIZE_ANY_EXHDR(fmt));
+	if (!(res = datetime_to_char_body(&tmtc, prog, false, PG_GET_COLLATION())))
 		PG_RETURN_NULL();
 
 	PG_RETURN_TEXT_P(res);
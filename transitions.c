@@ -0,0 +1,351 @@
+#include "storage/ipc.h"
+#include "storage/lwlock.h"
+#include "storage/shmem.h"
+#include "utils/guc.h"
+#include "utils/memutils.h"
+
+/*
+ * Per-zone tables of UTC offset transitions.  For instants inside the covered
+ * years the local time is a binary search plus an add, outside of them the
+ * callers fall back to timestamp2tm and the full pg_tz rules.
+ */
+typedef struct TzTransition {
+	Timestamp at;		/* UTC instant the offset takes effect */
+	int32 gmtoff;		/* seconds east of UTC */
+	int32 isdst;
+} TzTransition;
+
+typedef struct TzTransitions {
+	Timestamp start;	/* covered UTC range is [start, end) */
+	Timestamp end;
+	int count;
+	TzTransition items[FLEXIBLE_ARRAY_MEMBER];
+} TzTransitions;
+
+static int transition_start_year = 1900;
+static int transition_end_year = 2100;
+
+/*
+ * When loaded through shared_preload_libraries the tables for every zone are
+ * built once in the postmaster and kept in shared memory, read only.  Each
+ * zone's table is at its offset from the start of data.  The size of the
+ * whole struct is kept in its own small segment, so backends that attach
+ * under EXEC_BACKEND don't have to build every table to find it.
+ */
+typedef struct TzSharedTransitions {
+	int start_year;
+	int end_year;
+	bool valid;		/* false if the tables didn't fit, see transitions_shmem_startup */
+	Size offsets[NTIMEZONES + 1];
+	char data[FLEXIBLE_ARRAY_MEMBER];
+} TzSharedTransitions;
+
+static MemoryContext transitions_context = NULL;
+static TzTransitions *tzid_transitions_cache[NTIMEZONES + 1];
+
+/* the last offset looked up and the utc range it holds for, output tends to repeat a zone */
+static struct {
+	int id;
+	Timestamp from;
+	Timestamp until;
+	int gmtoff;
+	int isdst;
+} last_offset;
+
+static TzSharedTransitions *shared_transitions = NULL;
+static Size shared_transitions_size = 0;
+/* the years the segment was sized for, the GUCs can change before a crash restart */
+static int shared_start_year;
+static int shared_end_year;
+static shmem_startup_hook_type prev_shmem_startup_hook = NULL;
+#if PG_VERSION_NUM >= 150000
+static shmem_request_hook_type prev_shmem_request_hook = NULL;
+#endif
+
+static pg_time_t year_to_pg_time(int year)
+{
+	return (pg_time_t) (date2j(year, 1, 1) - UNIX_EPOCH_JDATE) * SECS_PER_DAY;
+}
+
+static Timestamp pg_time_to_timestamp(pg_time_t t)
+{
+	return (t - (Timestamp) (POSTGRES_EPOCH_JDATE - UNIX_EPOCH_JDATE) * SECS_PER_DAY) * USECS_PER_SEC;
+}
+
+static TzTransitions *build_transitions(int id, int start_year, int end_year)
+{
+	pg_tz *tzp = tzid_to_tzp(id);
+	pg_time_t start = year_to_pg_time(start_year);
+	pg_time_t end = year_to_pg_time(end_year + 1);
+	pg_time_t t, boundary;
+	long before_gmtoff, after_gmtoff;
+	int before_isdst, after_isdst;
+	int res, count = 0, allocated = 64;
+	TzTransitions *trans;
+
+	if(transitions_context == NULL)
+		transitions_context = AllocSetContextCreate(TopMemoryContext,
+			"timestampandtz transitions", ALLOCSET_DEFAULT_SIZES);
+
+	trans = MemoryContextAlloc(transitions_context,
+		offsetof(TzTransitions, items) + allocated * sizeof(TzTransition));
+	trans->start = pg_time_to_timestamp(start);
+	trans->end = pg_time_to_timestamp(end);
+	trans->count = 0;
+
+	/* no usable zone data (or an empty range), every lookup falls back */
+	if(tzp == NULL || start >= end)
+		return trans;
+
+	t = start;
+	res = pg_next_dst_boundary(&t, &before_gmtoff, &before_isdst,
+		&boundary, &after_gmtoff, &after_isdst, tzp);
+	if(res < 0)
+		return trans;
+
+	trans->items[count].at = trans->start;
+	trans->items[count].gmtoff = before_gmtoff;
+	trans->items[count].isdst = before_isdst;
+	count++;
+
+	while(res == 1 && boundary < end)
+	{
+		if(count == allocated)
+		{
+			allocated *= 2;
+			trans = repalloc(trans, offsetof(TzTransitions, items) + allocated * sizeof(TzTransition));
+		}
+
+		trans->items[count].at = pg_time_to_timestamp(boundary);
+		trans->items[count].gmtoff = after_gmtoff;
+		trans->items[count].isdst = after_isdst;
+		count++;
+
+		t = boundary;
+		res = pg_next_dst_boundary(&t, &before_gmtoff, &before_isdst,
+			&boundary, &after_gmtoff, &after_isdst, tzp);
+	}
+
+	/* a failure part way leaves nothing we can trust */
+	if(res >= 0)
+		trans->count = count;
+	return trans;
+}
+
+static Size transitions_size(TzTransitions *trans)
+{
+	return MAXALIGN(offsetof(TzTransitions, items) + trans->count * sizeof(TzTransition));
+}
+
+static TzTransitions *tzid_to_transitions(int id)
+{
+	TzTransitions *trans;
+
+	Assert(id >= 1 && id <= (int) NTIMEZONES);
+	trans = tzid_transitions_cache[id];
+
+	if(trans == NULL)
+	{
+		/* the shared tables are only good for the years they were built with */
+		if(shared_transitions != NULL &&
+			shared_transitions->start_year == transition_start_year &&
+			shared_transitions->end_year == transition_end_year)
+			trans = (TzTransitions *) (shared_transitions->data + shared_transitions->offsets[id]);
+		else
+			trans = build_transitions(id, transition_start_year, transition_end_year);
+		tzid_transitions_cache[id] = trans;
+	}
+
+	return trans;
+}
+
+static void transitions_reset(void)
+{
+	if(transitions_context != NULL)
+		MemoryContextReset(transitions_context);
+	memset(tzid_transitions_cache, 0, sizeof(tzid_transitions_cache));
+	last_offset.id = 0;
+}
+
+/* the covered years changed, throw the tables away and rebuild them on demand */
+static void transitions_assign_year(int newval, void *extra)
+{
+	transitions_reset();
+}
+
+/*
+ * Build the tables of every zone in the postmaster, sizing the shared memory
+ * segment they are copied into at startup.  Called from _PG_init while
+ * shared_preload_libraries is being processed.
+ */
+static void transitions_shmem_init(void)
+{
+	int id;
+
+	shared_start_year = transition_start_year;
+	shared_end_year = transition_end_year;
+
+	shared_transitions_size = MAXALIGN(offsetof(TzSharedTransitions, data));
+	for(id = 1; id <= NTIMEZONES; id++)
+		shared_transitions_size += transitions_size(build_transitions(id, shared_start_year, shared_end_year));
+
+	transitions_reset();
+}
+
+static Size transitions_shmem_request_size(void)
+{
+	/* ShmemInitStruct rounds each allocation up to a cache line */
+	return add_size(CACHELINEALIGN(sizeof(Size)), CACHELINEALIGN(shared_transitions_size));
+}
+
+#if PG_VERSION_NUM >= 150000
+static void transitions_shmem_request(void)
+{
+	if(prev_shmem_request_hook)
+		prev_shmem_request_hook();
+
+	RequestAddinShmemSpace(transitions_shmem_request_size());
+}
+#endif
+
+static void transitions_shmem_startup(void)
+{
+	TzSharedTransitions *shared;
+	Size *size;
+	bool found;
+	int id;
+
+	if(prev_shmem_startup_hook)
+		prev_shmem_startup_hook();
+
+	/* a restart after a crash must build from the zone rules again, not the old segment */
+	shared_transitions = NULL;
+
+	LWLockAcquire(AddinShmemInitLock, LW_EXCLUSIVE);
+
+	size = ShmemInitStruct("timestampandtz transitions size", sizeof(Size), &found);
+	if(!found)
+		*size = shared_transitions_size;
+
+	shared = ShmemInitStruct("timestampandtz transitions", *size, &found);
+
+	if(!found)
+	{
+		Size offset = 0;
+		Size limit = *size - offsetof(TzSharedTransitions, data);
+
+		/* the same years the segment was sized for, whatever the GUCs say now */
+		shared->start_year = shared_start_year;
+		shared->end_year = shared_end_year;
+		shared->offsets[0] = 0;
+
+		for(id = 1; id <= NTIMEZONES; id++)
+		{
+			TzTransitions *trans = build_transitions(id, shared_start_year, shared_end_year);
+
+			/* the zone rules changed under us, leave the tables to each backend */
+			if(offset + transitions_size(trans) > limit)
+				break;
+
+			memcpy(shared->data + offset, trans,
+				offsetof(TzTransitions, items) + trans->count * sizeof(TzTransition));
+			shared->offsets[id] = offset;
+			offset += transitions_size(trans);
+		}
+		shared->valid = id > NTIMEZONES;
+	}
+
+	LWLockRelease(AddinShmemInitLock);
+
+	/* the postmaster's private copies aren't needed any more */
+	transitions_reset();
+	if(shared->valid)
+		shared_transitions = shared;
+}
+
+static void transitions_install_shmem_hooks(void)
+{
+	/* backends started under EXEC_BACKEND only attach, they find the size in shared memory */
+	if(!IsUnderPostmaster)
+		transitions_shmem_init();
+
+#if PG_VERSION_NUM >= 150000
+	prev_shmem_request_hook = shmem_request_hook;
+	shmem_request_hook = transitions_shmem_request;
+#else
+	RequestAddinShmemSpace(transitions_shmem_request_size());
+#endif
+
+	prev_shmem_startup_hook = shmem_startup_hook;
+	shmem_startup_hook = transitions_shmem_startup;
+}
+
+/*
+ * Find the UTC offset (seconds east) and dst flag in effect for the zone at
+ * the UTC instant.  Returns false when the instant isn't covered by the table.
+ */
+static bool tzid_utc_offset(int id, Timestamp utc, int *gmtoff, int *isdst)
+{
+	TzTransitions *trans;
+	const TzTransition *base;
+	int n;
+
+	if(id == 0)
+		return false;
+
+	if(id == last_offset.id && utc >= last_offset.from && utc < last_offset.until)
+	{
+		*gmtoff = last_offset.gmtoff;
+		if(isdst)
+			*isdst = last_offset.isdst;
+		return true;
+	}
+
+	trans = tzid_to_transitions(id);
+	if(trans->count == 0 || utc < trans->start || utc >= trans->end)
+		return false;
+
+	/* last transition at or before utc, items[0] is at the start of the range */
+	base = trans->items;
+	n = trans->count;
+	while(n > 1)
+	{
+		int half = n / 2;
+
+		base = (base[half].at <= utc) ? base + half : base;
+		n -= half;
+	}
+
+	last_offset.id = id;
+	last_offset.from = base->at;
+	last_offset.until = (base + 1 < trans->items + trans->count) ? base[1].at : trans->end;
+	last_offset.gmtoff = base->gmtoff;
+	last_offset.isdst = base->isdst;
+
+	*gmtoff = base->gmtoff;
+	if(isdst)
+		*isdst = base->isdst;
+	return true;
+}
+
+/*
+ * timestamp2tm into the zone of a timestampandtz, using the transition table
+ * when it covers the instant.  tm_zone is only filled in on the fallback path.
+ */
+static int tzid_timestamp2tm(Timestamp dt, int id, int *tz, struct pg_tm *tm, fsec_t *fsec, pg_tz *tzp)
+{
+	int gmtoff, isdst;
+
+	if(!TIMESTAMP_NOT_FINITE(dt) && tzid_utc_offset(id, dt, &gmtoff, &isdst))
+	{
+		if(timestamp2tm(dt + (Timestamp) gmtoff * USECS_PER_SEC, NULL, tm, fsec, NULL, NULL) != 0)
+			return -1;
+
+		tm->tm_isdst = isdst;
+		tm->tm_gmtoff = gmtoff;
+		*tz = -gmtoff;
+		return 0;
+	}
+
+	return timestamp2tm(dt, tz, tm, fsec, NULL, tzp);
+}
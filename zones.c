@@ -1,604 +1,607 @@
+/* generated by sorter.c, do not edit */
+
 struct timezone_to_id {
 	const char *name;
 	const char *nameupper;
 	int id;
+	int namelen;
 };
 
 static struct timezone_to_id timezones[] = {
-	{ "Africa/Abidjan", "AFRICA/ABIDJAN", 1 },
-	{ "Africa/Accra", "AFRICA/ACCRA", 2 },
-	{ "Africa/Addis_Ababa", "AFRICA/ADDIS_ABABA", 3 },
-	{ "Africa/Algiers", "AFRICA/ALGIERS", 4 },
-	{ "Africa/Asmara", "AFRICA/ASMARA", 5 },
-	{ "Africa/Asmera", "AFRICA/ASMERA", 6 },
-	{ "Africa/Bamako", "AFRICA/BAMAKO", 7 },
-	{ "Africa/Bangui", "AFRICA/BANGUI", 8 },
-	{ "Africa/Banjul", "AFRICA/BANJUL", 9 },
-	{ "Africa/Bissau", "AFRICA/BISSAU", 10 },
-	{ "Africa/Blantyre", "AFRICA/BLANTYRE", 11 },
-	{ "Africa/Brazzaville", "AFRICA/BRAZZAVILLE", 12 },
-	{ "Africa/Bujumbura", "AFRICA/BUJUMBURA", 13 },
-	{ "Africa/Cairo", "AFRICA/CAIRO", 14 },
-	{ "Africa/Casablanca", "AFRICA/CASABLANCA", 15 },
-	{ "Africa/Ceuta", "AFRICA/CEUTA", 16 },
-	{ "Africa/Conakry", "AFRICA/CONAKRY", 17 },
-	{ "Africa/Dakar", "AFRICA/DAKAR", 18 },
-	{ "Africa/Dar_es_Salaam", "AFRICA/DAR_ES_SALAAM", 19 },
-	{ "Africa/Djibouti", "AFRICA/DJIBOUTI", 20 },
-	{ "Africa/Douala", "AFRICA/DOUALA", 21 },
-	{ "Africa/El_Aaiun", "AFRICA/EL_AAIUN", 22 },
-	{ "Africa/Freetown", "AFRICA/FREETOWN", 23 },
-	{ "Africa/Gaborone", "AFRICA/GABORONE", 24 },
-	{ "Africa/Harare", "AFRICA/HARARE", 25 },
-	{ "Africa/Johannesburg", "AFRICA/JOHANNESBURG", 26 },
-	{ "Africa/Juba", "AFRICA/JUBA", 27 },
-	{ "Africa/Kampala", "AFRICA/KAMPALA", 28 },
-	{ "Africa/Khartoum", "AFRICA/KHARTOUM", 29 },
-	{ "Africa/Kigali", "AFRICA/KIGALI", 30 },
-	{ "Africa/Kinshasa", "AFRICA/KINSHASA", 31 },
-	{ "Africa/Lagos", "AFRICA/LAGOS", 32 },
-	{ "Africa/Libreville", "AFRICA/LIBREVILLE", 33 },
-	{ "Africa/Lome", "AFRICA/LOME", 34 },
-	{ "Africa/Luanda", "AFRICA/LUANDA", 35 },
-	{ "Africa/Lubumbashi", "AFRICA/LUBUMBASHI", 36 },
-	{ "Africa/Lusaka", "AFRICA/LUSAKA", 37 },
-	{ "Africa/Malabo", "AFRICA/MALABO", 38 },
-	{ "Africa/Maputo", "AFRICA/MAPUTO", 39 },
-	{ "Africa/Maseru", "AFRICA/MASERU", 40 },
-	{ "Africa/Mbabane", "AFRICA/MBABANE", 41 },
-	{ "Africa/Mogadishu", "AFRICA/MOGADISHU", 42 },
-	{ "Africa/Monrovia", "AFRICA/MONROVIA", 43 },
-	{ "Africa/Nairobi", "AFRICA/NAIROBI", 44 },
-	{ "Africa/Ndjamena", "AFRICA/NDJAMENA", 45 },
-	{ "Africa/Niamey", "AFRICA/NIAMEY", 46 },
-	{ "Africa/Nouakchott", "AFRICA/NOUAKCHOTT", 47 },
-	{ "Africa/Ouagadougou", "AFRICA/OUAGADOUGOU", 48 },
-	{ "Africa/Porto-Novo", "AFRICA/PORTO-NOVO", 49 },
-	{ "Africa/Sao_Tome", "AFRICA/SAO_TOME", 50 },
-	{ "Africa/Timbuktu", "AFRICA/TIMBUKTU", 51 },
-	{ "Africa/Tripoli", "AFRICA/TRIPOLI", 52 },
-	{ "Africa/Tunis", "AFRICA/TUNIS", 53 },
-	{ "Africa/Windhoek", "AFRICA/WINDHOEK", 54 },
-	{ "America/Adak", "AMERICA/ADAK", 55 },
-	{ "America/Anchorage", "AMERICA/ANCHORAGE", 56 },
-	{ "America/Anguilla", "AMERICA/ANGUILLA", 57 },
-	{ "America/Antigua", "AMERICA/ANTIGUA", 58 },
-	{ "America/Araguaina", "AMERICA/ARAGUAINA", 59 },
-	{ "America/Argentina/Buenos_Aires", "AMERICA/ARGENTINA/BUENOS_AIRES", 60 },
-	{ "America/Argentina/Catamarca", "AMERICA/ARGENTINA/CATAMARCA", 61 },
-	{ "America/Argentina/ComodRivadavia", "AMERICA/ARGENTINA/COMODRIVADAVIA", 62 },
-	{ "America/Argentina/Cordoba", "AMERICA/ARGENTINA/CORDOBA", 63 },
-	{ "America/Argentina/Jujuy", "AMERICA/ARGENTINA/JUJUY", 64 },
-	{ "America/Argentina/La_Rioja", "AMERICA/ARGENTINA/LA_RIOJA", 65 },
-	{ "America/Argentina/Mendoza", "AMERICA/ARGENTINA/MENDOZA", 66 },
-	{ "America/Argentina/Rio_Gallegos", "AMERICA/ARGENTINA/RIO_GALLEGOS", 67 },
-	{ "America/Argentina/Salta", "AMERICA/ARGENTINA/SALTA", 68 },
-	{ "America/Argentina/San_Juan", "AMERICA/ARGENTINA/SAN_JUAN", 69 },
-	{ "America/Argentina/San_Luis", "AMERICA/ARGENTINA/SAN_LUIS", 70 },
-	{ "America/Argentina/Tucuman", "AMERICA/ARGENTINA/TUCUMAN", 71 },
-	{ "America/Argentina/Ushuaia", "AMERICA/ARGENTINA/USHUAIA", 72 },
-	{ "America/Aruba", "AMERICA/ARUBA", 73 },
-	{ "America/Asuncion", "AMERICA/ASUNCION", 74 },
-	{ "America/Atikokan", "AMERICA/ATIKOKAN", 75 },
-	{ "America/Atka", "AMERICA/ATKA", 76 },
-	{ "America/Bahia", "AMERICA/BAHIA", 77 },
-	{ "America/Bahia_Banderas", "AMERICA/BAHIA_BANDERAS", 78 },
-	{ "America/Barbados", "AMERICA/BARBADOS", 79 },
-	{ "America/Belem", "AMERICA/BELEM", 80 },
-	{ "America/Belize", "AMERICA/BELIZE", 81 },
-	{ "America/Blanc-Sablon", "AMERICA/BLANC-SABLON", 82 },
-	{ "America/Boa_Vista", "AMERICA/BOA_VISTA", 83 },
-	{ "America/Bogota", "AMERICA/BOGOTA", 84 },
-	{ "America/Boise", "AMERICA/BOISE", 85 },
-	{ "America/Buenos_Aires", "AMERICA/BUENOS_AIRES", 86 },
-	{ "America/Cambridge_Bay", "AMERICA/CAMBRIDGE_BAY", 87 },
-	{ "America/Campo_Grande", "AMERICA/CAMPO_GRANDE", 88 },
-	{ "America/Cancun", "AMERICA/CANCUN", 89 },
-	{ "America/Caracas", "AMERICA/CARACAS", 90 },
-	{ "America/Catamarca", "AMERICA/CATAMARCA", 91 },
-	{ "America/Cayenne", "AMERICA/CAYENNE", 92 },
-	{ "America/Cayman", "AMERICA/CAYMAN", 93 },
-	{ "America/Chicago", "AMERICA/CHICAGO", 94 },
-	{ "America/Chihuahua", "AMERICA/CHIHUAHUA", 95 },
-	{ "America/Coral_Harbour", "AMERICA/CORAL_HARBOUR", 96 },
-	{ "America/Cordoba", "AMERICA/CORDOBA", 97 },
-	{ "America/Costa_Rica", "AMERICA/COSTA_RICA", 98 },
-	{ "America/Creston", "AMERICA/CRESTON", 99 },
-	{ "America/Cuiaba", "AMERICA/CUIABA", 100 },
-	{ "America/Curacao", "AMERICA/CURACAO", 101 },
-	{ "America/Danmarkshavn", "AMERICA/DANMARKSHAVN", 102 },
-	{ "America/Dawson", "AMERICA/DAWSON", 103 },
-	{ "America/Dawson_Creek", "AMERICA/DAWSON_CREEK", 104 },
-	{ "America/Denver", "AMERICA/DENVER", 105 },
-	{ "America/Detroit", "AMERICA/DETROIT", 106 },
-	{ "America/Dominica", "AMERICA/DOMINICA", 107 },
-	{ "America/Edmonton", "AMERICA/EDMONTON", 108 },
-	{ "America/Eirunepe", "AMERICA/EIRUNEPE", 109 },
-	{ "America/El_Salvador", "AMERICA/EL_SALVADOR", 110 },
-	{ "America/Ensenada", "AMERICA/ENSENADA", 111 },
-	{ "America/Fortaleza", "AMERICA/FORTALEZA", 113 },
-	{ "America/Fort_Nelson", "AMERICA/FORT_NELSON", 582 },
-	{ "America/Fort_Wayne", "AMERICA/FORT_WAYNE", 112 },
-	{ "America/Glace_Bay", "AMERICA/GLACE_BAY", 114 },
-	{ "America/Godthab", "AMERICA/GODTHAB", 115 },
-	{ "America/Goose_Bay", "AMERICA/GOOSE_BAY", 116 },
-	{ "America/Grand_Turk", "AMERICA/GRAND_TURK", 117 },
-	{ "America/Grenada", "AMERICA/GRENADA", 118 },
-	{ "America/Guadeloupe", "AMERICA/GUADELOUPE", 119 },
-	{ "America/Guatemala", "AMERICA/GUATEMALA", 120 },
-	{ "America/Guayaquil", "AMERICA/GUAYAQUIL", 121 },
-	{ "America/Guyana", "AMERICA/GUYANA", 122 },
-	{ "America/Halifax", "AMERICA/HALIFAX", 123 },
-	{ "America/Havana", "AMERICA/HAVANA", 124 },
-	{ "America/Hermosillo", "AMERICA/HERMOSILLO", 125 },
-	{ "America/Indiana/Indianapolis", "AMERICA/INDIANA/INDIANAPOLIS", 126 },
-	{ "America/Indiana/Knox", "AMERICA/INDIANA/KNOX", 127 },
-	{ "America/Indiana/Marengo", "AMERICA/INDIANA/MARENGO", 128 },
-	{ "America/Indiana/Petersburg", "AMERICA/INDIANA/PETERSBURG", 129 },
-	{ "America/Indiana/Tell_City", "AMERICA/INDIANA/TELL_CITY", 130 },
-	{ "America/Indiana/Vevay", "AMERICA/INDIANA/VEVAY", 131 },
-	{ "America/Indiana/Vincennes", "AMERICA/INDIANA/VINCENNES", 132 },
-	{ "America/Indiana/Winamac", "AMERICA/INDIANA/WINAMAC", 133 },
-	{ "America/Indianapolis", "AMERICA/INDIANAPOLIS", 134 },
-	{ "America/Inuvik", "AMERICA/INUVIK", 135 },
-	{ "America/Iqaluit", "AMERICA/IQALUIT", 136 },
-	{ "America/Jamaica", "AMERICA/JAMAICA", 137 },
-	{ "America/Jujuy", "AMERICA/JUJUY", 138 },
-	{ "America/Juneau", "AMERICA/JUNEAU", 139 },
-	{ "America/Kentucky/Louisville", "AMERICA/KENTUCKY/LOUISVILLE", 140 },
-	{ "America/Kentucky/Monticello", "AMERICA/KENTUCKY/MONTICELLO", 141 },
-	{ "America/Knox_IN", "AMERICA/KNOX_IN", 142 },
-	{ "America/Kralendijk", "AMERICA/KRALENDIJK", 143 },
-	{ "America/La_Paz", "AMERICA/LA_PAZ", 144 },
-	{ "America/Lima", "AMERICA/LIMA", 145 },
-	{ "America/Los_Angeles", "AMERICA/LOS_ANGELES", 146 },
-	{ "America/Louisville", "AMERICA/LOUISVILLE", 147 },
-	{ "America/Lower_Princes", "AMERICA/LOWER_PRINCES", 148 },
-	{ "America/Maceio", "AMERICA/MACEIO", 149 },
-	{ "America/Managua", "AMERICA/MANAGUA", 150 },
-	{ "America/Manaus", "AMERICA/MANAUS", 151 },
-	{ "America/Marigot", "AMERICA/MARIGOT", 152 },
-	{ "America/Martinique", "AMERICA/MARTINIQUE", 153 },
-	{ "America/Matamoros", "AMERICA/MATAMOROS", 154 },
-	{ "America/Mazatlan", "AMERICA/MAZATLAN", 155 },
-	{ "America/Mendoza", "AMERICA/MENDOZA", 156 },
-	{ "America/Menominee", "AMERICA/MENOMINEE", 157 },
-	{ "America/Merida", "AMERICA/MERIDA", 158 },
-	{ "America/Metlakatla", "AMERICA/METLAKATLA", 159 },
-	{ "America/Mexico_City", "AMERICA/MEXICO_CITY", 160 },
-	{ "America/Miquelon", "AMERICA/MIQUELON", 161 },
-	{ "America/Moncton", "AMERICA/MONCTON", 162 },
-	{ "America/Monterrey", "AMERICA/MONTERREY", 163 },
-	{ "America/Montevideo", "AMERICA/MONTEVIDEO", 164 },
-	{ "America/Montreal", "AMERICA/MONTREAL", 165 },
-	{ "America/Montserrat", "AMERICA/MONTSERRAT", 166 },
-	{ "America/Nassau", "AMERICA/NASSAU", 167 },
-	{ "America/New_York", "AMERICA/NEW_YORK", 168 },
-	{ "America/Nipigon", "AMERICA/NIPIGON", 169 },
-	{ "America/Nome", "AMERICA/NOME", 170 },
-	{ "America/Noronha", "AMERICA/NORONHA", 171 },
-	{ "America/North_Dakota/Beulah", "AMERICA/NORTH_DAKOTA/BEULAH", 172 },
-	{ "America/North_Dakota/Center", "AMERICA/NORTH_DAKOTA/CENTER", 173 },
-	{ "America/North_Dakota/New_Salem", "AMERICA/NORTH_DAKOTA/NEW_SALEM", 174 },
-	{ "America/Ojinaga", "AMERICA/OJINAGA", 175 },
-	{ "America/Panama", "AMERICA/PANAMA", 176 },
-	{ "America/Pangnirtung", "AMERICA/PANGNIRTUNG", 177 },
-	{ "America/Paramaribo", "AMERICA/PARAMARIBO", 178 },
-	{ "America/Phoenix", "AMERICA/PHOENIX", 179 },
-	{ "America/Port-au-Prince", "AMERICA/PORT-AU-PRINCE", 180 },
-	{ "America/Porto_Acre", "AMERICA/PORTO_ACRE", 182 },
-	{ "America/Porto_Velho", "AMERICA/PORTO_VELHO", 183 },
-	{ "America/Port_of_Spain", "AMERICA/PORT_OF_SPAIN", 181 },
-	{ "America/Puerto_Rico", "AMERICA/PUERTO_RICO", 184 },
-	{ "America/Punta_Arenas", "AMERICA/PUNTA_ARENAS", 581 },
-	{ "America/Rainy_River", "AMERICA/RAINY_RIVER", 185 },
-	{ "America/Rankin_Inlet", "AMERICA/RANKIN_INLET", 186 },
-	{ "America/Recife", "AMERICA/RECIFE", 187 },
-	{ "America/Regina", "AMERICA/REGINA", 188 },
-	{ "America/Resolute", "AMERICA/RESOLUTE", 189 },
-	{ "America/Rio_Branco", "AMERICA/RIO_BRANCO", 190 },
-	{ "America/Rosario", "AMERICA/ROSARIO", 191 },
-	{ "America/Santarem", "AMERICA/SANTAREM", 193 },
-	{ "America/Santa_Isabel", "AMERICA/SANTA_ISABEL", 192 },
-	{ "America/Santiago", "AMERICA/SANTIAGO", 194 },
-	{ "America/Santo_Domingo", "AMERICA/SANTO_DOMINGO", 195 },
-	{ "America/Sao_Paulo", "AMERICA/SAO_PAULO", 196 },
-	{ "America/Scoresbysund", "AMERICA/SCORESBYSUND", 197 },
-	{ "America/Shiprock", "AMERICA/SHIPROCK", 198 },
-	{ "America/Sitka", "AMERICA/SITKA", 199 },
-	{ "America/St_Barthelemy", "AMERICA/ST_BARTHELEMY", 200 },
-	{ "America/St_Johns", "AMERICA/ST_JOHNS", 201 },
-	{ "America/St_Kitts", "AMERICA/ST_KITTS", 202 },
-	{ "America/St_Lucia", "AMERICA/ST_LUCIA", 203 },
-	{ "America/St_Thomas", "AMERICA/ST_THOMAS", 204 },
-	{ "America/St_Vincent", "AMERICA/ST_VINCENT", 205 },
-	{ "America/Swift_Current", "AMERICA/SWIFT_CURRENT", 206 },
-	{ "America/Tegucigalpa", "AMERICA/TEGUCIGALPA", 207 },
-	{ "America/Thule", "AMERICA/THULE", 208 },
-	{ "America/Thunder_Bay", "AMERICA/THUNDER_BAY", 209 },
-	{ "America/Tijuana", "AMERICA/TIJUANA", 210 },
-	{ "America/Toronto", "AMERICA/TORONTO", 211 },
-	{ "America/Tortola", "AMERICA/TORTOLA", 212 },
-	{ "America/Vancouver", "AMERICA/VANCOUVER", 213 },
-	{ "America/Virgin", "AMERICA/VIRGIN", 214 },
-	{ "America/Whitehorse", "AMERICA/WHITEHORSE", 215 },
-	{ "America/Winnipeg", "AMERICA/WINNIPEG", 216 },
-	{ "America/Yakutat", "AMERICA/YAKUTAT", 217 },
-	{ "America/Yellowknife", "AMERICA/YELLOWKNIFE", 218 },
-	{ "Antarctica/Casey", "ANTARCTICA/CASEY", 219 },
-	{ "Antarctica/Davis", "ANTARCTICA/DAVIS", 220 },
-	{ "Antarctica/DumontDUrville", "ANTARCTICA/DUMONTDURVILLE", 221 },
-	{ "Antarctica/Macquarie", "ANTARCTICA/MACQUARIE", 222 },
-	{ "Antarctica/Mawson", "ANTARCTICA/MAWSON", 223 },
-	{ "Antarctica/McMurdo", "ANTARCTICA/MCMURDO", 224 },
-	{ "Antarctica/Palmer", "ANTARCTICA/PALMER", 225 },
-	{ "Antarctica/Rothera", "ANTARCTICA/ROTHERA", 226 },
-	{ "Antarctica/South_Pole", "ANTARCTICA/SOUTH_POLE", 227 },
-	{ "Antarctica/Syowa", "ANTARCTICA/SYOWA", 228 },
-	{ "Antarctica/Troll", "ANTARCTICA/TROLL", 229 },
-	{ "Antarctica/Vostok", "ANTARCTICA/VOSTOK", 230 },
-	{ "Arctic/Longyearbyen", "ARCTIC/LONGYEARBYEN", 231 },
-	{ "Asia/Aden", "ASIA/ADEN", 232 },
-	{ "Asia/Almaty", "ASIA/ALMATY", 233 },
-	{ "Asia/Amman", "ASIA/AMMAN", 234 },
-	{ "Asia/Anadyr", "ASIA/ANADYR", 235 },
-	{ "Asia/Aqtau", "ASIA/AQTAU", 236 },
-	{ "Asia/Aqtobe", "ASIA/AQTOBE", 237 },
-	{ "Asia/Ashgabat", "ASIA/ASHGABAT", 238 },
-	{ "Asia/Ashkhabad", "ASIA/ASHKHABAD", 239 },
-	{ "Asia/Atyrau", "ASIA/ATYRAU", 583 },
-	{ "Asia/Baghdad", "ASIA/BAGHDAD", 240 },
-	{ "Asia/Bahrain", "ASIA/BAHRAIN", 241 },
-	{ "Asia/Baku", "ASIA/BAKU", 242 },
-	{ "Asia/Bangkok", "ASIA/BANGKOK", 243 },
-	{ "Asia/Barnaul", "ASIA/BARNAUL", 586 },
-	{ "Asia/Beirut", "ASIA/BEIRUT", 244 },
-	{ "Asia/Bishkek", "ASIA/BISHKEK", 245 },
-	{ "Asia/Brunei", "ASIA/BRUNEI", 246 },
-	{ "Asia/Calcutta", "ASIA/CALCUTTA", 247 },
-	{ "Asia/Chita", "ASIA/CHITA", 585 },
-	{ "Asia/Choibalsan", "ASIA/CHOIBALSAN", 248 },
-	{ "Asia/Chongqing", "ASIA/CHONGQING", 249 },
-	{ "Asia/Chungking", "ASIA/CHUNGKING", 250 },
-	{ "Asia/Colombo", "ASIA/COLOMBO", 251 },
-	{ "Asia/Dacca", "ASIA/DACCA", 252 },
-	{ "Asia/Damascus", "ASIA/DAMASCUS", 253 },
-	{ "Asia/Dhaka", "ASIA/DHAKA", 254 },
-	{ "Asia/Dili", "ASIA/DILI", 255 },
-	{ "Asia/Dubai", "ASIA/DUBAI", 256 },
-	{ "Asia/Dushanbe", "ASIA/DUSHANBE", 257 },
-	{ "Asia/Famagusta", "ASIA/FAMAGUSTA", 589 },
-	{ "Asia/Gaza", "ASIA/GAZA", 258 },
-	{ "Asia/Harbin", "ASIA/HARBIN", 259 },
-	{ "Asia/Hebron", "ASIA/HEBRON", 260 },
-	{ "Asia/Hong_Kong", "ASIA/HONG_KONG", 262 },
-	{ "Asia/Hovd", "ASIA/HOVD", 263 },
-	{ "Asia/Ho_Chi_Minh", "ASIA/HO_CHI_MINH", 261 },
-	{ "Asia/Irkutsk", "ASIA/IRKUTSK", 264 },
-	{ "Asia/Istanbul", "ASIA/ISTANBUL", 265 },
-	{ "Asia/Jakarta", "ASIA/JAKARTA", 266 },
-	{ "Asia/Jayapura", "ASIA/JAYAPURA", 267 },
-	{ "Asia/Jerusalem", "ASIA/JERUSALEM", 268 },
-	{ "Asia/Kabul", "ASIA/KABUL", 269 },
-	{ "Asia/Kamchatka", "ASIA/KAMCHATKA", 270 },
-	{ "Asia/Karachi", "ASIA/KARACHI", 271 },
-	{ "Asia/Kashgar", "ASIA/KASHGAR", 272 },
-	{ "Asia/Kathmandu", "ASIA/KATHMANDU", 273 },
-	{ "Asia/Katmandu", "ASIA/KATMANDU", 274 },
-	{ "Asia/Khandyga", "ASIA/KHANDYGA", 275 },
-	{ "Asia/Kolkata", "ASIA/KOLKATA", 276 },
-	{ "Asia/Krasnoyarsk", "ASIA/KRASNOYARSK", 277 },
-	{ "Asia/Kuala_Lumpur", "ASIA/KUALA_LUMPUR", 278 },
-	{ "Asia/Kuching", "ASIA/KUCHING", 279 },
-	{ "Asia/Kuwait", "ASIA/KUWAIT", 280 },
-	{ "Asia/Macao", "ASIA/MACAO", 281 },
-	{ "Asia/Macau", "ASIA/MACAU", 282 },
-	{ "Asia/Magadan", "ASIA/MAGADAN", 283 },
-	{ "Asia/Makassar", "ASIA/MAKASSAR", 284 },
-	{ "Asia/Manila", "ASIA/MANILA", 285 },
-	{ "Asia/Muscat", "ASIA/MUSCAT", 286 },
-	{ "Asia/Nicosia", "ASIA/NICOSIA", 287 },
-	{ "Asia/Novokuznetsk", "ASIA/NOVOKUZNETSK", 288 },
-	{ "Asia/Novosibirsk", "ASIA/NOVOSIBIRSK", 289 },
-	{ "Asia/Omsk", "ASIA/OMSK", 290 },
-	{ "Asia/Oral", "ASIA/ORAL", 291 },
-	{ "Asia/Phnom_Penh", "ASIA/PHNOM_PENH", 292 },
-	{ "Asia/Pontianak", "ASIA/PONTIANAK", 293 },
-	{ "Asia/Pyongyang", "ASIA/PYONGYANG", 294 },
-	{ "Asia/Qatar", "ASIA/QATAR", 295 },
-	{ "Asia/Qyzylorda", "ASIA/QYZYLORDA", 296 },
-	{ "Asia/Rangoon", "ASIA/RANGOON", 297 },
-	{ "Asia/Riyadh", "ASIA/RIYADH", 298 },
-	{ "Asia/Saigon", "ASIA/SAIGON", 299 },
-	{ "Asia/Sakhalin", "ASIA/SAKHALIN", 300 },
-	{ "Asia/Samarkand", "ASIA/SAMARKAND", 301 },
-	{ "Asia/Seoul", "ASIA/SEOUL", 302 },
-	{ "Asia/Shanghai", "ASIA/SHANGHAI", 303 },
-	{ "Asia/Singapore", "ASIA/SINGAPORE", 304 },
-	{ "Asia/Srednekolymsk", "ASIA/SREDNEKOLYMSK", 588 },
-	{ "Asia/Taipei", "ASIA/TAIPEI", 305 },
-	{ "Asia/Tashkent", "ASIA/TASHKENT", 306 },
-	{ "Asia/Tbilisi", "ASIA/TBILISI", 307 },
-	{ "Asia/Tehran", "ASIA/TEHRAN", 308 },
-	{ "Asia/Tel_Aviv", "ASIA/TEL_AVIV", 309 },
-	{ "Asia/Thimbu", "ASIA/THIMBU", 310 },
-	{ "Asia/Thimphu", "ASIA/THIMPHU", 311 },
-	{ "Asia/Tokyo", "ASIA/TOKYO", 312 },
-	{ "Asia/Tomsk", "ASIA/TOMSK", 584 },
-	{ "Asia/Ujung_Pandang", "ASIA/UJUNG_PANDANG", 313 },
-	{ "Asia/Ulaanbaatar", "ASIA/ULAANBAATAR", 314 },
-	{ "Asia/Ulan_Bator", "ASIA/ULAN_BATOR", 315 },
-	{ "Asia/Urumqi", "ASIA/URUMQI", 316 },
-	{ "Asia/Ust-Nera", "ASIA/UST-NERA", 317 },
-	{ "Asia/Vientiane", "ASIA/VIENTIANE", 318 },
-	{ "Asia/Vladivostok", "ASIA/VLADIVOSTOK", 319 },
-	{ "Asia/Yakutsk", "ASIA/YAKUTSK", 320 },
-	{ "Asia/Yangon", "ASIA/YANGON", 587 },
-	{ "Asia/Yekaterinburg", "ASIA/YEKATERINBURG", 321 },
-	{ "Asia/Yerevan", "ASIA/YEREVAN", 322 },
-	{ "Atlantic/Azores", "ATLANTIC/AZORES", 323 },
-	{ "Atlantic/Bermuda", "ATLANTIC/BERMUDA", 324 },
-	{ "Atlantic/Canary", "ATLANTIC/CANARY", 325 },
-	{ "Atlantic/Cape_Verde", "ATLANTIC/CAPE_VERDE", 326 },
-	{ "Atlantic/Faeroe", "ATLANTIC/FAEROE", 327 },
-	{ "Atlantic/Faroe", "ATLANTIC/FAROE", 328 },
-	{ "Atlantic/Jan_Mayen", "ATLANTIC/JAN_MAYEN", 329 },
-	{ "Atlantic/Madeira", "ATLANTIC/MADEIRA", 330 },
-	{ "Atlantic/Reykjavik", "ATLANTIC/REYKJAVIK", 331 },
-	{ "Atlantic/South_Georgia", "ATLANTIC/SOUTH_GEORGIA", 332 },
-	{ "Atlantic/Stanley", "ATLANTIC/STANLEY", 334 },
-	{ "Atlantic/St_Helena", "ATLANTIC/ST_HELENA", 333 },
-	{ "Australia/ACT", "AUSTRALIA/ACT", 335 },
-	{ "Australia/Adelaide", "AUSTRALIA/ADELAIDE", 336 },
-	{ "Australia/Brisbane", "AUSTRALIA/BRISBANE", 337 },
-	{ "Australia/Broken_Hill", "AUSTRALIA/BROKEN_HILL", 338 },
-	{ "Australia/Canberra", "AUSTRALIA/CANBERRA", 339 },
-	{ "Australia/Currie", "AUSTRALIA/CURRIE", 340 },
-	{ "Australia/Darwin", "AUSTRALIA/DARWIN", 341 },
-	{ "Australia/Eucla", "AUSTRALIA/EUCLA", 342 },
-	{ "Australia/Hobart", "AUSTRALIA/HOBART", 343 },
-	{ "Australia/LHI", "AUSTRALIA/LHI", 344 },
-	{ "Australia/Lindeman", "AUSTRALIA/LINDEMAN", 345 },
-	{ "Australia/Lord_Howe", "AUSTRALIA/LORD_HOWE", 346 },
-	{ "Australia/Melbourne", "AUSTRALIA/MELBOURNE", 347 },
-	{ "Australia/North", "AUSTRALIA/NORTH", 349 },
-	{ "Australia/NSW", "AUSTRALIA/NSW", 348 },
-	{ "Australia/Perth", "AUSTRALIA/PERTH", 350 },
-	{ "Australia/Queensland", "AUSTRALIA/QUEENSLAND", 351 },
-	{ "Australia/South", "AUSTRALIA/SOUTH", 352 },
-	{ "Australia/Sydney", "AUSTRALIA/SYDNEY", 353 },
-	{ "Australia/Tasmania", "AUSTRALIA/TASMANIA", 354 },
-	{ "Australia/Victoria", "AUSTRALIA/VICTORIA", 355 },
-	{ "Australia/West", "AUSTRALIA/WEST", 356 },
-	{ "Australia/Yancowinna", "AUSTRALIA/YANCOWINNA", 357 },
-	{ "Brazil/Acre", "BRAZIL/ACRE", 358 },
-	{ "Brazil/DeNoronha", "BRAZIL/DENORONHA", 359 },
-	{ "Brazil/East", "BRAZIL/EAST", 360 },
-	{ "Brazil/West", "BRAZIL/WEST", 361 },
-	{ "Canada/Atlantic", "CANADA/ATLANTIC", 364 },
-	{ "Canada/Central", "CANADA/CENTRAL", 365 },
-	{ "Canada/East-Saskatchewan", "CANADA/EAST-SASKATCHEWAN", 366 },
-	{ "Canada/Eastern", "CANADA/EASTERN", 367 },
-	{ "Canada/Mountain", "CANADA/MOUNTAIN", 368 },
-	{ "Canada/Newfoundland", "CANADA/NEWFOUNDLAND", 369 },
-	{ "Canada/Pacific", "CANADA/PACIFIC", 370 },
-	{ "Canada/Saskatchewan", "CANADA/SASKATCHEWAN", 371 },
-	{ "Canada/Yukon", "CANADA/YUKON", 372 },
-	{ "CET", "CET", 362 },
-	{ "Chile/Continental", "CHILE/CONTINENTAL", 373 },
-	{ "Chile/EasterIsland", "CHILE/EASTERISLAND", 374 },
-	{ "CST6CDT", "CST6CDT", 363 },
-	{ "Cuba", "CUBA", 375 },
-	{ "EET", "EET", 376 },
-	{ "Egypt", "EGYPT", 379 },
-	{ "Eire", "EIRE", 380 },
-	{ "EST", "EST", 377 },
-	{ "EST5EDT", "EST5EDT", 378 },
-	{ "Etc/GMT", "ETC/GMT", 381 },
-	{ "Etc/GMT+0", "ETC/GMT+0", 382 },
-	{ "Etc/GMT+1", "ETC/GMT+1", 383 },
-	{ "Etc/GMT+10", "ETC/GMT+10", 384 },
-	{ "Etc/GMT+11", "ETC/GMT+11", 385 },
-	{ "Etc/GMT+12", "ETC/GMT+12", 386 },
-	{ "Etc/GMT+2", "ETC/GMT+2", 387 },
-	{ "Etc/GMT+3", "ETC/GMT+3", 388 },
-	{ "Etc/GMT+4", "ETC/GMT+4", 389 },
-	{ "Etc/GMT+5", "ETC/GMT+5", 390 },
-	{ "Etc/GMT+6", "ETC/GMT+6", 391 },
-	{ "Etc/GMT+7", "ETC/GMT+7", 392 },
-	{ "Etc/GMT+8", "ETC/GMT+8", 393 },
-	{ "Etc/GMT+9", "ETC/GMT+9", 394 },
-	{ "Etc/GMT-0", "ETC/GMT-0", 395 },
-	{ "Etc/GMT-1", "ETC/GMT-1", 396 },
-	{ "Etc/GMT-10", "ETC/GMT-10", 397 },
-	{ "Etc/GMT-11", "ETC/GMT-11", 398 },
-	{ "Etc/GMT-12", "ETC/GMT-12", 399 },
-	{ "Etc/GMT-13", "ETC/GMT-13", 400 },
-	{ "Etc/GMT-14", "ETC/GMT-14", 401 },
-	{ "Etc/GMT-2", "ETC/GMT-2", 402 },
-	{ "Etc/GMT-3", "ETC/GMT-3", 403 },
-	{ "Etc/GMT-4", "ETC/GMT-4", 404 },
-	{ "Etc/GMT-5", "ETC/GMT-5", 405 },
-	{ "Etc/GMT-6", "ETC/GMT-6", 406 },
-	{ "Etc/GMT-7", "ETC/GMT-7", 407 },
-	{ "Etc/GMT-8", "ETC/GMT-8", 408 },
-	{ "Etc/GMT-9", "ETC/GMT-9", 409 },
-	{ "Etc/GMT0", "ETC/GMT0", 410 },
-	{ "Etc/Greenwich", "ETC/GREENWICH", 411 },
-	{ "Etc/UCT", "ETC/UCT", 412 },
-	{ "Etc/Universal", "ETC/UNIVERSAL", 414 },
-	{ "Etc/UTC", "ETC/UTC", 413 },
-	{ "Etc/Zulu", "ETC/ZULU", 415 },
-	{ "Europe/Amsterdam", "EUROPE/AMSTERDAM", 416 },
-	{ "Europe/Andorra", "EUROPE/ANDORRA", 417 },
-	{ "Europe/Astrakhan", "EUROPE/ASTRAKHAN", 593 },
-	{ "Europe/Athens", "EUROPE/ATHENS", 418 },
-	{ "Europe/Belfast", "EUROPE/BELFAST", 419 },
-	{ "Europe/Belgrade", "EUROPE/BELGRADE", 420 },
-	{ "Europe/Berlin", "EUROPE/BERLIN", 421 },
-	{ "Europe/Bratislava", "EUROPE/BRATISLAVA", 422 },
-	{ "Europe/Brussels", "EUROPE/BRUSSELS", 423 },
-	{ "Europe/Bucharest", "EUROPE/BUCHAREST", 424 },
-	{ "Europe/Budapest", "EUROPE/BUDAPEST", 425 },
-	{ "Europe/Busingen", "EUROPE/BUSINGEN", 426 },
-	{ "Europe/Chisinau", "EUROPE/CHISINAU", 427 },
-	{ "Europe/Copenhagen", "EUROPE/COPENHAGEN", 428 },
-	{ "Europe/Dublin", "EUROPE/DUBLIN", 429 },
-	{ "Europe/Gibraltar", "EUROPE/GIBRALTAR", 430 },
-	{ "Europe/Guernsey", "EUROPE/GUERNSEY", 431 },
-	{ "Europe/Helsinki", "EUROPE/HELSINKI", 432 },
-	{ "Europe/Isle_of_Man", "EUROPE/ISLE_OF_MAN", 433 },
-	{ "Europe/Istanbul", "EUROPE/ISTANBUL", 434 },
-	{ "Europe/Jersey", "EUROPE/JERSEY", 435 },
-	{ "Europe/Kaliningrad", "EUROPE/KALININGRAD", 436 },
-	{ "Europe/Kiev", "EUROPE/KIEV", 437 },
-	{ "Europe/Kirov", "EUROPE/KIROV", 592 },
-	{ "Europe/Lisbon", "EUROPE/LISBON", 438 },
-	{ "Europe/Ljubljana", "EUROPE/LJUBLJANA", 439 },
-	{ "Europe/London", "EUROPE/LONDON", 440 },
-	{ "Europe/Luxembourg", "EUROPE/LUXEMBOURG", 441 },
-	{ "Europe/Madrid", "EUROPE/MADRID", 442 },
-	{ "Europe/Malta", "EUROPE/MALTA", 443 },
-	{ "Europe/Mariehamn", "EUROPE/MARIEHAMN", 444 },
-	{ "Europe/Minsk", "EUROPE/MINSK", 445 },
-	{ "Europe/Monaco", "EUROPE/MONACO", 446 },
-	{ "Europe/Moscow", "EUROPE/MOSCOW", 447 },
-	{ "Europe/Nicosia", "EUROPE/NICOSIA", 448 },
-	{ "Europe/Oslo", "EUROPE/OSLO", 449 },
-	{ "Europe/Paris", "EUROPE/PARIS", 450 },
-	{ "Europe/Podgorica", "EUROPE/PODGORICA", 451 },
-	{ "Europe/Prague", "EUROPE/PRAGUE", 452 },
-	{ "Europe/Riga", "EUROPE/RIGA", 453 },
-	{ "Europe/Rome", "EUROPE/ROME", 454 },
-	{ "Europe/Samara", "EUROPE/SAMARA", 455 },
-	{ "Europe/San_Marino", "EUROPE/SAN_MARINO", 456 },
-	{ "Europe/Sarajevo", "EUROPE/SARAJEVO", 457 },
-	{ "Europe/Saratov", "EUROPE/SARATOV", 591 },
-	{ "Europe/Simferopol", "EUROPE/SIMFEROPOL", 458 },
-	{ "Europe/Skopje", "EUROPE/SKOPJE", 459 },
-	{ "Europe/Sofia", "EUROPE/SOFIA", 460 },
-	{ "Europe/Stockholm", "EUROPE/STOCKHOLM", 461 },
-	{ "Europe/Tallinn", "EUROPE/TALLINN", 462 },
-	{ "Europe/Tirane", "EUROPE/TIRANE", 463 },
-	{ "Europe/Tiraspol", "EUROPE/TIRASPOL", 464 },
-	{ "Europe/Ulyanovsk", "EUROPE/ULYANOVSK", 590 },
-	{ "Europe/Uzhgorod", "EUROPE/UZHGOROD", 465 },
-	{ "Europe/Vaduz", "EUROPE/VADUZ", 466 },
-	{ "Europe/Vatican", "EUROPE/VATICAN", 467 },
-	{ "Europe/Vienna", "EUROPE/VIENNA", 468 },
-	{ "Europe/Vilnius", "EUROPE/VILNIUS", 469 },
-	{ "Europe/Volgograd", "EUROPE/VOLGOGRAD", 470 },
-	{ "Europe/Warsaw", "EUROPE/WARSAW", 471 },
-	{ "Europe/Zagreb", "EUROPE/ZAGREB", 472 },
-	{ "Europe/Zaporozhye", "EUROPE/ZAPOROZHYE", 473 },
-	{ "Europe/Zurich", "EUROPE/ZURICH", 474 },
-	{ "GB", "GB", 475 },
-	{ "GB-Eire", "GB-EIRE", 476 },
-	{ "GMT", "GMT", 477 },
-	{ "GMT+0", "GMT+0", 478 },
-	{ "GMT-0", "GMT-0", 479 },
-	{ "GMT0", "GMT0", 480 },
-	{ "Greenwich", "GREENWICH", 481 },
-	{ "Hongkong", "HONGKONG", 483 },
-	{ "HST", "HST", 482 },
-	{ "Iceland", "ICELAND", 484 },
-	{ "Indian/Antananarivo", "INDIAN/ANTANANARIVO", 485 },
-	{ "Indian/Chagos", "INDIAN/CHAGOS", 486 },
-	{ "Indian/Christmas", "INDIAN/CHRISTMAS", 487 },
-	{ "Indian/Cocos", "INDIAN/COCOS", 488 },
-	{ "Indian/Comoro", "INDIAN/COMORO", 489 },
-	{ "Indian/Kerguelen", "INDIAN/KERGUELEN", 490 },
-	{ "Indian/Mahe", "INDIAN/MAHE", 491 },
-	{ "Indian/Maldives", "INDIAN/MALDIVES", 492 },
-	{ "Indian/Mauritius", "INDIAN/MAURITIUS", 493 },
-	{ "Indian/Mayotte", "INDIAN/MAYOTTE", 494 },
-	{ "Indian/Reunion", "INDIAN/REUNION", 495 },
-	{ "Iran", "IRAN", 496 },
-	{ "Israel", "ISRAEL", 497 },
-	{ "Jamaica", "JAMAICA", 498 },
-	{ "Japan", "JAPAN", 499 },
-	{ "Kwajalein", "KWAJALEIN", 500 },
-	{ "Libya", "LIBYA", 501 },
-	{ "MET", "MET", 502 },
-	{ "Mexico/BajaNorte", "MEXICO/BAJANORTE", 505 },
-	{ "Mexico/BajaSur", "MEXICO/BAJASUR", 506 },
-	{ "Mexico/General", "MEXICO/GENERAL", 507 },
-	{ "MST", "MST", 503 },
-	{ "MST7MDT", "MST7MDT", 504 },
-	{ "Navajo", "NAVAJO", 510 },
-	{ "NZ", "NZ", 508 },
-	{ "NZ-CHAT", "NZ-CHAT", 509 },
-	{ "Pacific/Apia", "PACIFIC/APIA", 513 },
-	{ "Pacific/Auckland", "PACIFIC/AUCKLAND", 514 },
-	{ "Pacific/Bougainville", "PACIFIC/BOUGAINVILLE", 580 },
-	{ "Pacific/Chatham", "PACIFIC/CHATHAM", 515 },
-	{ "Pacific/Chuuk", "PACIFIC/CHUUK", 516 },
-	{ "Pacific/Easter", "PACIFIC/EASTER", 517 },
-	{ "Pacific/Efate", "PACIFIC/EFATE", 518 },
-	{ "Pacific/Enderbury", "PACIFIC/ENDERBURY", 519 },
-	{ "Pacific/Fakaofo", "PACIFIC/FAKAOFO", 520 },
-	{ "Pacific/Fiji", "PACIFIC/FIJI", 521 },
-	{ "Pacific/Funafuti", "PACIFIC/FUNAFUTI", 522 },
-	{ "Pacific/Galapagos", "PACIFIC/GALAPAGOS", 523 },
-	{ "Pacific/Gambier", "PACIFIC/GAMBIER", 524 },
-	{ "Pacific/Guadalcanal", "PACIFIC/GUADALCANAL", 525 },
-	{ "Pacific/Guam", "PACIFIC/GUAM", 526 },
-	{ "Pacific/Honolulu", "PACIFIC/HONOLULU", 527 },
-	{ "Pacific/Johnston", "PACIFIC/JOHNSTON", 528 },
-	{ "Pacific/Kiritimati", "PACIFIC/KIRITIMATI", 529 },
-	{ "Pacific/Kosrae", "PACIFIC/KOSRAE", 530 },
-	{ "Pacific/Kwajalein", "PACIFIC/KWAJALEIN", 531 },
-	{ "Pacific/Majuro", "PACIFIC/MAJURO", 532 },
-	{ "Pacific/Marquesas", "PACIFIC/MARQUESAS", 533 },
-	{ "Pacific/Midway", "PACIFIC/MIDWAY", 534 },
-	{ "Pacific/Nauru", "PACIFIC/NAURU", 535 },
-	{ "Pacific/Niue", "PACIFIC/NIUE", 536 },
-	{ "Pacific/Norfolk", "PACIFIC/NORFOLK", 537 },
-	{ "Pacific/Noumea", "PACIFIC/NOUMEA", 538 },
-	{ "Pacific/Pago_Pago", "PACIFIC/PAGO_PAGO", 539 },
-	{ "Pacific/Palau", "PACIFIC/PALAU", 540 },
-	{ "Pacific/Pitcairn", "PACIFIC/PITCAIRN", 541 },
-	{ "Pacific/Pohnpei", "PACIFIC/POHNPEI", 542 },
-	{ "Pacific/Ponape", "PACIFIC/PONAPE", 543 },
-	{ "Pacific/Port_Moresby", "PACIFIC/PORT_MORESBY", 544 },
-	{ "Pacific/Rarotonga", "PACIFIC/RAROTONGA", 545 },
-	{ "Pacific/Saipan", "PACIFIC/SAIPAN", 546 },
-	{ "Pacific/Samoa", "PACIFIC/SAMOA", 547 },
-	{ "Pacific/Tahiti", "PACIFIC/TAHITI", 548 },
-	{ "Pacific/Tarawa", "PACIFIC/TARAWA", 549 },
-	{ "Pacific/Tongatapu", "PACIFIC/TONGATAPU", 550 },
-	{ "Pacific/Truk", "PACIFIC/TRUK", 551 },
-	{ "Pacific/Wake", "PACIFIC/WAKE", 552 },
-	{ "Pacific/Wallis", "PACIFIC/WALLIS", 553 },
-	{ "Pacific/Yap", "PACIFIC/YAP", 554 },
-	{ "Poland", "POLAND", 555 },
-	{ "Portugal", "PORTUGAL", 556 },
-	{ "posixrules", "POSIXRULES", 594 },
-	{ "PRC", "PRC", 511 },
-	{ "PST8PDT", "PST8PDT", 512 },
-	{ "ROC", "ROC", 557 },
-	{ "ROK", "ROK", 558 },
-	{ "Singapore", "SINGAPORE", 559 },
-	{ "Turkey", "TURKEY", 560 },
-	{ "UCT", "UCT", 561 },
-	{ "Universal", "UNIVERSAL", 576 },
-	{ "US/Alaska", "US/ALASKA", 562 },
-	{ "US/Aleutian", "US/ALEUTIAN", 563 },
-	{ "US/Arizona", "US/ARIZONA", 564 },
-	{ "US/Central", "US/CENTRAL", 565 },
-	{ "US/East-Indiana", "US/EAST-INDIANA", 566 },
-	{ "US/Eastern", "US/EASTERN", 567 },
-	{ "US/Hawaii", "US/HAWAII", 568 },
-	{ "US/Indiana-Starke", "US/INDIANA-STARKE", 569 },
-	{ "US/Michigan", "US/MICHIGAN", 570 },
-	{ "US/Mountain", "US/MOUNTAIN", 571 },
-	{ "US/Pacific", "US/PACIFIC", 572 },
-	{ "US/Pacific-New", "US/PACIFIC-NEW", 573 },
-	{ "US/Samoa", "US/SAMOA", 574 },
-	{ "UTC", "UTC", 575 },
-	{ "W-SU", "W-SU", 577 },
-	{ "WET", "WET", 578 },
-	{ "Zulu", "ZULU", 579 },
+	{ "Africa/Abidjan", "AFRICA/ABIDJAN", 1, 14 },
+	{ "Africa/Accra", "AFRICA/ACCRA", 2, 12 },
+	{ "Africa/Addis_Ababa", "AFRICA/ADDIS_ABABA", 3, 18 },
+	{ "Africa/Algiers", "AFRICA/ALGIERS", 4, 14 },
+	{ "Africa/Asmara", "AFRICA/ASMARA", 5, 13 },
+	{ "Africa/Asmera", "AFRICA/ASMERA", 6, 13 },
+	{ "Africa/Bamako", "AFRICA/BAMAKO", 7, 13 },
+	{ "Africa/Bangui", "AFRICA/BANGUI", 8, 13 },
+	{ "Africa/Banjul", "AFRICA/BANJUL", 9, 13 },
+	{ "Africa/Bissau", "AFRICA/BISSAU", 10, 13 },
+	{ "Africa/Blantyre", "AFRICA/BLANTYRE", 11, 15 },
+	{ "Africa/Brazzaville", "AFRICA/BRAZZAVILLE", 12, 18 },
+	{ "Africa/Bujumbura", "AFRICA/BUJUMBURA", 13, 16 },
+	{ "Africa/Cairo", "AFRICA/CAIRO", 14, 12 },
+	{ "Africa/Casablanca", "AFRICA/CASABLANCA", 15, 17 },
+	{ "Africa/Ceuta", "AFRICA/CEUTA", 16, 12 },
+	{ "Africa/Conakry", "AFRICA/CONAKRY", 17, 14 },
+	{ "Africa/Dakar", "AFRICA/DAKAR", 18, 12 },
+	{ "Africa/Dar_es_Salaam", "AFRICA/DAR_ES_SALAAM", 19, 20 },
+	{ "Africa/Djibouti", "AFRICA/DJIBOUTI", 20, 15 },
+	{ "Africa/Douala", "AFRICA/DOUALA", 21, 13 },
+	{ "Africa/El_Aaiun", "AFRICA/EL_AAIUN", 22, 15 },
+	{ "Africa/Freetown", "AFRICA/FREETOWN", 23, 15 },
+	{ "Africa/Gaborone", "AFRICA/GABORONE", 24, 15 },
+	{ "Africa/Harare", "AFRICA/HARARE", 25, 13 },
+	{ "Africa/Johannesburg", "AFRICA/JOHANNESBURG", 26, 19 },
+	{ "Africa/Juba", "AFRICA/JUBA", 27, 11 },
+	{ "Africa/Kampala", "AFRICA/KAMPALA", 28, 14 },
+	{ "Africa/Khartoum", "AFRICA/KHARTOUM", 29, 15 },
+	{ "Africa/Kigali", "AFRICA/KIGALI", 30, 13 },
+	{ "Africa/Kinshasa", "AFRICA/KINSHASA", 31, 15 },
+	{ "Africa/Lagos", "AFRICA/LAGOS", 32, 12 },
+	{ "Africa/Libreville", "AFRICA/LIBREVILLE", 33, 17 },
+	{ "Africa/Lome", "AFRICA/LOME", 34, 11 },
+	{ "Africa/Luanda", "AFRICA/LUANDA", 35, 13 },
+	{ "Africa/Lubumbashi", "AFRICA/LUBUMBASHI", 36, 17 },
+	{ "Africa/Lusaka", "AFRICA/LUSAKA", 37, 13 },
+	{ "Africa/Malabo", "AFRICA/MALABO", 38, 13 },
+	{ "Africa/Maputo", "AFRICA/MAPUTO", 39, 13 },
+	{ "Africa/Maseru", "AFRICA/MASERU", 40, 13 },
+	{ "Africa/Mbabane", "AFRICA/MBABANE", 41, 14 },
+	{ "Africa/Mogadishu", "AFRICA/MOGADISHU", 42, 16 },
+	{ "Africa/Monrovia", "AFRICA/MONROVIA", 43, 15 },
+	{ "Africa/Nairobi", "AFRICA/NAIROBI", 44, 14 },
+	{ "Africa/Ndjamena", "AFRICA/NDJAMENA", 45, 15 },
+	{ "Africa/Niamey", "AFRICA/NIAMEY", 46, 13 },
+	{ "Africa/Nouakchott", "AFRICA/NOUAKCHOTT", 47, 17 },
+	{ "Africa/Ouagadougou", "AFRICA/OUAGADOUGOU", 48, 18 },
+	{ "Africa/Porto-Novo", "AFRICA/PORTO-NOVO", 49, 17 },
+	{ "Africa/Sao_Tome", "AFRICA/SAO_TOME", 50, 15 },
+	{ "Africa/Timbuktu", "AFRICA/TIMBUKTU", 51, 15 },
+	{ "Africa/Tripoli", "AFRICA/TRIPOLI", 52, 14 },
+	{ "Africa/Tunis", "AFRICA/TUNIS", 53, 12 },
+	{ "Africa/Windhoek", "AFRICA/WINDHOEK", 54, 15 },
+	{ "America/Adak", "AMERICA/ADAK", 55, 12 },
+	{ "America/Anchorage", "AMERICA/ANCHORAGE", 56, 17 },
+	{ "America/Anguilla", "AMERICA/ANGUILLA", 57, 16 },
+	{ "America/Antigua", "AMERICA/ANTIGUA", 58, 15 },
+	{ "America/Araguaina", "AMERICA/ARAGUAINA", 59, 17 },
+	{ "America/Argentina/Buenos_Aires", "AMERICA/ARGENTINA/BUENOS_AIRES", 60, 30 },
+	{ "America/Argentina/Catamarca", "AMERICA/ARGENTINA/CATAMARCA", 61, 27 },
+	{ "America/Argentina/ComodRivadavia", "AMERICA/ARGENTINA/COMODRIVADAVIA", 62, 32 },
+	{ "America/Argentina/Cordoba", "AMERICA/ARGENTINA/CORDOBA", 63, 25 },
+	{ "America/Argentina/Jujuy", "AMERICA/ARGENTINA/JUJUY", 64, 23 },
+	{ "America/Argentina/La_Rioja", "AMERICA/ARGENTINA/LA_RIOJA", 65, 26 },
+	{ "America/Argentina/Mendoza", "AMERICA/ARGENTINA/MENDOZA", 66, 25 },
+	{ "America/Argentina/Rio_Gallegos", "AMERICA/ARGENTINA/RIO_GALLEGOS", 67, 30 },
+	{ "America/Argentina/Salta", "AMERICA/ARGENTINA/SALTA", 68, 23 },
+	{ "America/Argentina/San_Juan", "AMERICA/ARGENTINA/SAN_JUAN", 69, 26 },
+	{ "America/Argentina/San_Luis", "AMERICA/ARGENTINA/SAN_LUIS", 70, 26 },
+	{ "America/Argentina/Tucuman", "AMERICA/ARGENTINA/TUCUMAN", 71, 25 },
+	{ "America/Argentina/Ushuaia", "AMERICA/ARGENTINA/USHUAIA", 72, 25 },
+	{ "America/Aruba", "AMERICA/ARUBA", 73, 13 },
+	{ "America/Asuncion", "AMERICA/ASUNCION", 74, 16 },
+	{ "America/Atikokan", "AMERICA/ATIKOKAN", 75, 16 },
+	{ "America/Atka", "AMERICA/ATKA", 76, 12 },
+	{ "America/Bahia", "AMERICA/BAHIA", 77, 13 },
+	{ "America/Bahia_Banderas", "AMERICA/BAHIA_BANDERAS", 78, 22 },
+	{ "America/Barbados", "AMERICA/BARBADOS", 79, 16 },
+	{ "America/Belem", "AMERICA/BELEM", 80, 13 },
+	{ "America/Belize", "AMERICA/BELIZE", 81, 14 },
+	{ "America/Blanc-Sablon", "AMERICA/BLANC-SABLON", 82, 20 },
+	{ "America/Boa_Vista", "AMERICA/BOA_VISTA", 83, 17 },
+	{ "America/Bogota", "AMERICA/BOGOTA", 84, 14 },
+	{ "America/Boise", "AMERICA/BOISE", 85, 13 },
+	{ "America/Buenos_Aires", "AMERICA/BUENOS_AIRES", 86, 20 },
+	{ "America/Cambridge_Bay", "AMERICA/CAMBRIDGE_BAY", 87, 21 },
+	{ "America/Campo_Grande", "AMERICA/CAMPO_GRANDE", 88, 20 },
+	{ "America/Cancun", "AMERICA/CANCUN", 89, 14 },
+	{ "America/Caracas", "AMERICA/CARACAS", 90, 15 },
+	{ "America/Catamarca", "AMERICA/CATAMARCA", 91, 17 },
+	{ "America/Cayenne", "AMERICA/CAYENNE", 92, 15 },
+	{ "America/Cayman", "AMERICA/CAYMAN", 93, 14 },
+	{ "America/Chicago", "AMERICA/CHICAGO", 94, 15 },
+	{ "America/Chihuahua", "AMERICA/CHIHUAHUA", 95, 17 },
+	{ "America/Coral_Harbour", "AMERICA/CORAL_HARBOUR", 96, 21 },
+	{ "America/Cordoba", "AMERICA/CORDOBA", 97, 15 },
+	{ "America/Costa_Rica", "AMERICA/COSTA_RICA", 98, 18 },
+	{ "America/Creston", "AMERICA/CRESTON", 99, 15 },
+	{ "America/Cuiaba", "AMERICA/CUIABA", 100, 14 },
+	{ "America/Curacao", "AMERICA/CURACAO", 101, 15 },
+	{ "America/Danmarkshavn", "AMERICA/DANMARKSHAVN", 102, 20 },
+	{ "America/Dawson", "AMERICA/DAWSON", 103, 14 },
+	{ "America/Dawson_Creek", "AMERICA/DAWSON_CREEK", 104, 20 },
+	{ "America/Denver", "AMERICA/DENVER", 105, 14 },
+	{ "America/Detroit", "AMERICA/DETROIT", 106, 15 },
+	{ "America/Dominica", "AMERICA/DOMINICA", 107, 16 },
+	{ "America/Edmonton", "AMERICA/EDMONTON", 108, 16 },
+	{ "America/Eirunepe", "AMERICA/EIRUNEPE", 109, 16 },
+	{ "America/El_Salvador", "AMERICA/EL_SALVADOR", 110, 19 },
+	{ "America/Ensenada", "AMERICA/ENSENADA", 111, 16 },
+	{ "America/Fortaleza", "AMERICA/FORTALEZA", 113, 17 },
+	{ "America/Fort_Nelson", "AMERICA/FORT_NELSON", 582, 19 },
+	{ "America/Fort_Wayne", "AMERICA/FORT_WAYNE", 112, 18 },
+	{ "America/Glace_Bay", "AMERICA/GLACE_BAY", 114, 17 },
+	{ "America/Godthab", "AMERICA/GODTHAB", 115, 15 },
+	{ "America/Goose_Bay", "AMERICA/GOOSE_BAY", 116, 17 },
+	{ "America/Grand_Turk", "AMERICA/GRAND_TURK", 117, 18 },
+	{ "America/Grenada", "AMERICA/GRENADA", 118, 15 },
+	{ "America/Guadeloupe", "AMERICA/GUADELOUPE", 119, 18 },
+	{ "America/Guatemala", "AMERICA/GUATEMALA", 120, 17 },
+	{ "America/Guayaquil", "AMERICA/GUAYAQUIL", 121, 17 },
+	{ "America/Guyana", "AMERICA/GUYANA", 122, 14 },
+	{ "America/Halifax", "AMERICA/HALIFAX", 123, 15 },
+	{ "America/Havana", "AMERICA/HAVANA", 124, 14 },
+	{ "America/Hermosillo", "AMERICA/HERMOSILLO", 125, 18 },
+	{ "America/Indiana/Indianapolis", "AMERICA/INDIANA/INDIANAPOLIS", 126, 28 },
+	{ "America/Indiana/Knox", "AMERICA/INDIANA/KNOX", 127, 20 },
+	{ "America/Indiana/Marengo", "AMERICA/INDIANA/MARENGO", 128, 23 },
+	{ "America/Indiana/Petersburg", "AMERICA/INDIANA/PETERSBURG", 129, 26 },
+	{ "America/Indiana/Tell_City", "AMERICA/INDIANA/TELL_CITY", 130, 25 },
+	{ "America/Indiana/Vevay", "AMERICA/INDIANA/VEVAY", 131, 21 },
+	{ "America/Indiana/Vincennes", "AMERICA/INDIANA/VINCENNES", 132, 25 },
+	{ "America/Indiana/Winamac", "AMERICA/INDIANA/WINAMAC", 133, 23 },
+	{ "America/Indianapolis", "AMERICA/INDIANAPOLIS", 134, 20 },
+	{ "America/Inuvik", "AMERICA/INUVIK", 135, 14 },
+	{ "America/Iqaluit", "AMERICA/IQALUIT", 136, 15 },
+	{ "America/Jamaica", "AMERICA/JAMAICA", 137, 15 },
+	{ "America/Jujuy", "AMERICA/JUJUY", 138, 13 },
+	{ "America/Juneau", "AMERICA/JUNEAU", 139, 14 },
+	{ "America/Kentucky/Louisville", "AMERICA/KENTUCKY/LOUISVILLE", 140, 27 },
+	{ "America/Kentucky/Monticello", "AMERICA/KENTUCKY/MONTICELLO", 141, 27 },
+	{ "America/Knox_IN", "AMERICA/KNOX_IN", 142, 15 },
+	{ "America/Kralendijk", "AMERICA/KRALENDIJK", 143, 18 },
+	{ "America/La_Paz", "AMERICA/LA_PAZ", 144, 14 },
+	{ "America/Lima", "AMERICA/LIMA", 145, 12 },
+	{ "America/Los_Angeles", "AMERICA/LOS_ANGELES", 146, 19 },
+	{ "America/Louisville", "AMERICA/LOUISVILLE", 147, 18 },
+	{ "America/Lower_Princes", "AMERICA/LOWER_PRINCES", 148, 21 },
+	{ "America/Maceio", "AMERICA/MACEIO", 149, 14 },
+	{ "America/Managua", "AMERICA/MANAGUA", 150, 15 },
+	{ "America/Manaus", "AMERICA/MANAUS", 151, 14 },
+	{ "America/Marigot", "AMERICA/MARIGOT", 152, 15 },
+	{ "America/Martinique", "AMERICA/MARTINIQUE", 153, 18 },
+	{ "America/Matamoros", "AMERICA/MATAMOROS", 154, 17 },
+	{ "America/Mazatlan", "AMERICA/MAZATLAN", 155, 16 },
+	{ "America/Mendoza", "AMERICA/MENDOZA", 156, 15 },
+	{ "America/Menominee", "AMERICA/MENOMINEE", 157, 17 },
+	{ "America/Merida", "AMERICA/MERIDA", 158, 14 },
+	{ "America/Metlakatla", "AMERICA/METLAKATLA", 159, 18 },
+	{ "America/Mexico_City", "AMERICA/MEXICO_CITY", 160, 19 },
+	{ "America/Miquelon", "AMERICA/MIQUELON", 161, 16 },
+	{ "America/Moncton", "AMERICA/MONCTON", 162, 15 },
+	{ "America/Monterrey", "AMERICA/MONTERREY", 163, 17 },
+	{ "America/Montevideo", "AMERICA/MONTEVIDEO", 164, 18 },
+	{ "America/Montreal", "AMERICA/MONTREAL", 165, 16 },
+	{ "America/Montserrat", "AMERICA/MONTSERRAT", 166, 18 },
+	{ "America/Nassau", "AMERICA/NASSAU", 167, 14 },
+	{ "America/New_York", "AMERICA/NEW_YORK", 168, 16 },
+	{ "America/Nipigon", "AMERICA/NIPIGON", 169, 15 },
+	{ "America/Nome", "AMERICA/NOME", 170, 12 },
+	{ "America/Noronha", "AMERICA/NORONHA", 171, 15 },
+	{ "America/North_Dakota/Beulah", "AMERICA/NORTH_DAKOTA/BEULAH", 172, 27 },
+	{ "America/North_Dakota/Center", "AMERICA/NORTH_DAKOTA/CENTER", 173, 27 },
+	{ "America/North_Dakota/New_Salem", "AMERICA/NORTH_DAKOTA/NEW_SALEM", 174, 30 },
+	{ "America/Ojinaga", "AMERICA/OJINAGA", 175, 15 },
+	{ "America/Panama", "AMERICA/PANAMA", 176, 14 },
+	{ "America/Pangnirtung", "AMERICA/PANGNIRTUNG", 177, 19 },
+	{ "America/Paramaribo", "AMERICA/PARAMARIBO", 178, 18 },
+	{ "America/Phoenix", "AMERICA/PHOENIX", 179, 15 },
+	{ "America/Port-au-Prince", "AMERICA/PORT-AU-PRINCE", 180, 22 },
+	{ "America/Porto_Acre", "AMERICA/PORTO_ACRE", 182, 18 },
+	{ "America/Porto_Velho", "AMERICA/PORTO_VELHO", 183, 19 },
+	{ "America/Port_of_Spain", "AMERICA/PORT_OF_SPAIN", 181, 21 },
+	{ "America/Puerto_Rico", "AMERICA/PUERTO_RICO", 184, 19 },
+	{ "America/Punta_Arenas", "AMERICA/PUNTA_ARENAS", 581, 20 },
+	{ "America/Rainy_River", "AMERICA/RAINY_RIVER", 185, 19 },
+	{ "America/Rankin_Inlet", "AMERICA/RANKIN_INLET", 186, 20 },
+	{ "America/Recife", "AMERICA/RECIFE", 187, 14 },
+	{ "America/Regina", "AMERICA/REGINA", 188, 14 },
+	{ "America/Resolute", "AMERICA/RESOLUTE", 189, 16 },
+	{ "America/Rio_Branco", "AMERICA/RIO_BRANCO", 190, 18 },
+	{ "America/Rosario", "AMERICA/ROSARIO", 191, 15 },
+	{ "America/Santarem", "AMERICA/SANTAREM", 193, 16 },
+	{ "America/Santa_Isabel", "AMERICA/SANTA_ISABEL", 192, 20 },
+	{ "America/Santiago", "AMERICA/SANTIAGO", 194, 16 },
+	{ "America/Santo_Domingo", "AMERICA/SANTO_DOMINGO", 195, 21 },
+	{ "America/Sao_Paulo", "AMERICA/SAO_PAULO", 196, 17 },
+	{ "America/Scoresbysund", "AMERICA/SCORESBYSUND", 197, 20 },
+	{ "America/Shiprock", "AMERICA/SHIPROCK", 198, 16 },
+	{ "America/Sitka", "AMERICA/SITKA", 199, 13 },
+	{ "America/St_Barthelemy", "AMERICA/ST_BARTHELEMY", 200, 21 },
+	{ "America/St_Johns", "AMERICA/ST_JOHNS", 201, 16 },
+	{ "America/St_Kitts", "AMERICA/ST_KITTS", 202, 16 },
+	{ "America/St_Lucia", "AMERICA/ST_LUCIA", 203, 16 },
+	{ "America/St_Thomas", "AMERICA/ST_THOMAS", 204, 17 },
+	{ "America/St_Vincent", "AMERICA/ST_VINCENT", 205, 18 },
+	{ "America/Swift_Current", "AMERICA/SWIFT_CURRENT", 206, 21 },
+	{ "America/Tegucigalpa", "AMERICA/TEGUCIGALPA", 207, 19 },
+	{ "America/Thule", "AMERICA/THULE", 208, 13 },
+	{ "America/Thunder_Bay", "AMERICA/THUNDER_BAY", 209, 19 },
+	{ "America/Tijuana", "AMERICA/TIJUANA", 210, 15 },
+	{ "America/Toronto", "AMERICA/TORONTO", 211, 15 },
+	{ "America/Tortola", "AMERICA/TORTOLA", 212, 15 },
+	{ "America/Vancouver", "AMERICA/VANCOUVER", 213, 17 },
+	{ "America/Virgin", "AMERICA/VIRGIN", 214, 14 },
+	{ "America/Whitehorse", "AMERICA/WHITEHORSE", 215, 18 },
+	{ "America/Winnipeg", "AMERICA/WINNIPEG", 216, 16 },
+	{ "America/Yakutat", "AMERICA/YAKUTAT", 217, 15 },
+	{ "America/Yellowknife", "AMERICA/YELLOWKNIFE", 218, 19 },
+	{ "Antarctica/Casey", "ANTARCTICA/CASEY", 219, 16 },
+	{ "Antarctica/Davis", "ANTARCTICA/DAVIS", 220, 16 },
+	{ "Antarctica/DumontDUrville", "ANTARCTICA/DUMONTDURVILLE", 221, 25 },
+	{ "Antarctica/Macquarie", "ANTARCTICA/MACQUARIE", 222, 20 },
+	{ "Antarctica/Mawson", "ANTARCTICA/MAWSON", 223, 17 },
+	{ "Antarctica/McMurdo", "ANTARCTICA/MCMURDO", 224, 18 },
+	{ "Antarctica/Palmer", "ANTARCTICA/PALMER", 225, 17 },
+	{ "Antarctica/Rothera", "ANTARCTICA/ROTHERA", 226, 18 },
+	{ "Antarctica/South_Pole", "ANTARCTICA/SOUTH_POLE", 227, 21 },
+	{ "Antarctica/Syowa", "ANTARCTICA/SYOWA", 228, 16 },
+	{ "Antarctica/Troll", "ANTARCTICA/TROLL", 229, 16 },
+	{ "Antarctica/Vostok", "ANTARCTICA/VOSTOK", 230, 17 },
+	{ "Arctic/Longyearbyen", "ARCTIC/LONGYEARBYEN", 231, 19 },
+	{ "Asia/Aden", "ASIA/ADEN", 232, 9 },
+	{ "Asia/Almaty", "ASIA/ALMATY", 233, 11 },
+	{ "Asia/Amman", "ASIA/AMMAN", 234, 10 },
+	{ "Asia/Anadyr", "ASIA/ANADYR", 235, 11 },
+	{ "Asia/Aqtau", "ASIA/AQTAU", 236, 10 },
+	{ "Asia/Aqtobe", "ASIA/AQTOBE", 237, 11 },
+	{ "Asia/Ashgabat", "ASIA/ASHGABAT", 238, 13 },
+	{ "Asia/Ashkhabad", "ASIA/ASHKHABAD", 239, 14 },
+	{ "Asia/Atyrau", "ASIA/ATYRAU", 583, 11 },
+	{ "Asia/Baghdad", "ASIA/BAGHDAD", 240, 12 },
+	{ "Asia/Bahrain", "ASIA/BAHRAIN", 241, 12 },
+	{ "Asia/Baku", "ASIA/BAKU", 242, 9 },
+	{ "Asia/Bangkok", "ASIA/BANGKOK", 243, 12 },
+	{ "Asia/Barnaul", "ASIA/BARNAUL", 586, 12 },
+	{ "Asia/Beirut", "ASIA/BEIRUT", 244, 11 },
+	{ "Asia/Bishkek", "ASIA/BISHKEK", 245, 12 },
+	{ "Asia/Brunei", "ASIA/BRUNEI", 246, 11 },
+	{ "Asia/Calcutta", "ASIA/CALCUTTA", 247, 13 },
+	{ "Asia/Chita", "ASIA/CHITA", 585, 10 },
+	{ "Asia/Choibalsan", "ASIA/CHOIBALSAN", 248, 15 },
+	{ "Asia/Chongqing", "ASIA/CHONGQING", 249, 14 },
+	{ "Asia/Chungking", "ASIA/CHUNGKING", 250, 14 },
+	{ "Asia/Colombo", "ASIA/COLOMBO", 251, 12 },
+	{ "Asia/Dacca", "ASIA/DACCA", 252, 10 },
+	{ "Asia/Damascus", "ASIA/DAMASCUS", 253, 13 },
+	{ "Asia/Dhaka", "ASIA/DHAKA", 254, 10 },
+	{ "Asia/Dili", "ASIA/DILI", 255, 9 },
+	{ "Asia/Dubai", "ASIA/DUBAI", 256, 10 },
+	{ "Asia/Dushanbe", "ASIA/DUSHANBE", 257, 13 },
+	{ "Asia/Famagusta", "ASIA/FAMAGUSTA", 589, 14 },
+	{ "Asia/Gaza", "ASIA/GAZA", 258, 9 },
+	{ "Asia/Harbin", "ASIA/HARBIN", 259, 11 },
+	{ "Asia/Hebron", "ASIA/HEBRON", 260, 11 },
+	{ "Asia/Hong_Kong", "ASIA/HONG_KONG", 262, 14 },
+	{ "Asia/Hovd", "ASIA/HOVD", 263, 9 },
+	{ "Asia/Ho_Chi_Minh", "ASIA/HO_CHI_MINH", 261, 16 },
+	{ "Asia/Irkutsk", "ASIA/IRKUTSK", 264, 12 },
+	{ "Asia/Istanbul", "ASIA/ISTANBUL", 265, 13 },
+	{ "Asia/Jakarta", "ASIA/JAKARTA", 266, 12 },
+	{ "Asia/Jayapura", "ASIA/JAYAPURA", 267, 13 },
+	{ "Asia/Jerusalem", "ASIA/JERUSALEM", 268, 14 },
+	{ "Asia/Kabul", "ASIA/KABUL", 269, 10 },
+	{ "Asia/Kamchatka", "ASIA/KAMCHATKA", 270, 14 },
+	{ "Asia/Karachi", "ASIA/KARACHI", 271, 12 },
+	{ "Asia/Kashgar", "ASIA/KASHGAR", 272, 12 },
+	{ "Asia/Kathmandu", "ASIA/KATHMANDU", 273, 14 },
+	{ "Asia/Katmandu", "ASIA/KATMANDU", 274, 13 },
+	{ "Asia/Khandyga", "ASIA/KHANDYGA", 275, 13 },
+	{ "Asia/Kolkata", "ASIA/KOLKATA", 276, 12 },
+	{ "Asia/Krasnoyarsk", "ASIA/KRASNOYARSK", 277, 16 },
+	{ "Asia/Kuala_Lumpur", "ASIA/KUALA_LUMPUR", 278, 17 },
+	{ "Asia/Kuching", "ASIA/KUCHING", 279, 12 },
+	{ "Asia/Kuwait", "ASIA/KUWAIT", 280, 11 },
+	{ "Asia/Macao", "ASIA/MACAO", 281, 10 },
+	{ "Asia/Macau", "ASIA/MACAU", 282, 10 },
+	{ "Asia/Magadan", "ASIA/MAGADAN", 283, 12 },
+	{ "Asia/Makassar", "ASIA/MAKASSAR", 284, 13 },
+	{ "Asia/Manila", "ASIA/MANILA", 285, 11 },
+	{ "Asia/Muscat", "ASIA/MUSCAT", 286, 11 },
+	{ "Asia/Nicosia", "ASIA/NICOSIA", 287, 12 },
+	{ "Asia/Novokuznetsk", "ASIA/NOVOKUZNETSK", 288, 17 },
+	{ "Asia/Novosibirsk", "ASIA/NOVOSIBIRSK", 289, 16 },
+	{ "Asia/Omsk", "ASIA/OMSK", 290, 9 },
+	{ "Asia/Oral", "ASIA/ORAL", 291, 9 },
+	{ "Asia/Phnom_Penh", "ASIA/PHNOM_PENH", 292, 15 },
+	{ "Asia/Pontianak", "ASIA/PONTIANAK", 293, 14 },
+	{ "Asia/Pyongyang", "ASIA/PYONGYANG", 294, 14 },
+	{ "Asia/Qatar", "ASIA/QATAR", 295, 10 },
+	{ "Asia/Qyzylorda", "ASIA/QYZYLORDA", 296, 14 },
+	{ "Asia/Rangoon", "ASIA/RANGOON", 297, 12 },
+	{ "Asia/Riyadh", "ASIA/RIYADH", 298, 11 },
+	{ "Asia/Saigon", "ASIA/SAIGON", 299, 11 },
+	{ "Asia/Sakhalin", "ASIA/SAKHALIN", 300, 13 },
+	{ "Asia/Samarkand", "ASIA/SAMARKAND", 301, 14 },
+	{ "Asia/Seoul", "ASIA/SEOUL", 302, 10 },
+	{ "Asia/Shanghai", "ASIA/SHANGHAI", 303, 13 },
+	{ "Asia/Singapore", "ASIA/SINGAPORE", 304, 14 },
+	{ "Asia/Srednekolymsk", "ASIA/SREDNEKOLYMSK", 588, 18 },
+	{ "Asia/Taipei", "ASIA/TAIPEI", 305, 11 },
+	{ "Asia/Tashkent", "ASIA/TASHKENT", 306, 13 },
+	{ "Asia/Tbilisi", "ASIA/TBILISI", 307, 12 },
+	{ "Asia/Tehran", "ASIA/TEHRAN", 308, 11 },
+	{ "Asia/Tel_Aviv", "ASIA/TEL_AVIV", 309, 13 },
+	{ "Asia/Thimbu", "ASIA/THIMBU", 310, 11 },
+	{ "Asia/Thimphu", "ASIA/THIMPHU", 311, 12 },
+	{ "Asia/Tokyo", "ASIA/TOKYO", 312, 10 },
+	{ "Asia/Tomsk", "ASIA/TOMSK", 584, 10 },
+	{ "Asia/Ujung_Pandang", "ASIA/UJUNG_PANDANG", 313, 18 },
+	{ "Asia/Ulaanbaatar", "ASIA/ULAANBAATAR", 314, 16 },
+	{ "Asia/Ulan_Bator", "ASIA/ULAN_BATOR", 315, 15 },
+	{ "Asia/Urumqi", "ASIA/URUMQI", 316, 11 },
+	{ "Asia/Ust-Nera", "ASIA/UST-NERA", 317, 13 },
+	{ "Asia/Vientiane", "ASIA/VIENTIANE", 318, 14 },
+	{ "Asia/Vladivostok", "ASIA/VLADIVOSTOK", 319, 16 },
+	{ "Asia/Yakutsk", "ASIA/YAKUTSK", 320, 12 },
+	{ "Asia/Yangon", "ASIA/YANGON", 587, 11 },
+	{ "Asia/Yekaterinburg", "ASIA/YEKATERINBURG", 321, 18 },
+	{ "Asia/Yerevan", "ASIA/YEREVAN", 322, 12 },
+	{ "Atlantic/Azores", "ATLANTIC/AZORES", 323, 15 },
+	{ "Atlantic/Bermuda", "ATLANTIC/BERMUDA", 324, 16 },
+	{ "Atlantic/Canary", "ATLANTIC/CANARY", 325, 15 },
+	{ "Atlantic/Cape_Verde", "ATLANTIC/CAPE_VERDE", 326, 19 },
+	{ "Atlantic/Faeroe", "ATLANTIC/FAEROE", 327, 15 },
+	{ "Atlantic/Faroe", "ATLANTIC/FAROE", 328, 14 },
+	{ "Atlantic/Jan_Mayen", "ATLANTIC/JAN_MAYEN", 329, 18 },
+	{ "Atlantic/Madeira", "ATLANTIC/MADEIRA", 330, 16 },
+	{ "Atlantic/Reykjavik", "ATLANTIC/REYKJAVIK", 331, 18 },
+	{ "Atlantic/South_Georgia", "ATLANTIC/SOUTH_GEORGIA", 332, 22 },
+	{ "Atlantic/Stanley", "ATLANTIC/STANLEY", 334, 16 },
+	{ "Atlantic/St_Helena", "ATLANTIC/ST_HELENA", 333, 18 },
+	{ "Australia/ACT", "AUSTRALIA/ACT", 335, 13 },
+	{ "Australia/Adelaide", "AUSTRALIA/ADELAIDE", 336, 18 },
+	{ "Australia/Brisbane", "AUSTRALIA/BRISBANE", 337, 18 },
+	{ "Australia/Broken_Hill", "AUSTRALIA/BROKEN_HILL", 338, 21 },
+	{ "Australia/Canberra", "AUSTRALIA/CANBERRA", 339, 18 },
+	{ "Australia/Currie", "AUSTRALIA/CURRIE", 340, 16 },
+	{ "Australia/Darwin", "AUSTRALIA/DARWIN", 341, 16 },
+	{ "Australia/Eucla", "AUSTRALIA/EUCLA", 342, 15 },
+	{ "Australia/Hobart", "AUSTRALIA/HOBART", 343, 16 },
+	{ "Australia/LHI", "AUSTRALIA/LHI", 344, 13 },
+	{ "Australia/Lindeman", "AUSTRALIA/LINDEMAN", 345, 18 },
+	{ "Australia/Lord_Howe", "AUSTRALIA/LORD_HOWE", 346, 19 },
+	{ "Australia/Melbourne", "AUSTRALIA/MELBOURNE", 347, 19 },
+	{ "Australia/North", "AUSTRALIA/NORTH", 349, 15 },
+	{ "Australia/NSW", "AUSTRALIA/NSW", 348, 13 },
+	{ "Australia/Perth", "AUSTRALIA/PERTH", 350, 15 },
+	{ "Australia/Queensland", "AUSTRALIA/QUEENSLAND", 351, 20 },
+	{ "Australia/South", "AUSTRALIA/SOUTH", 352, 15 },
+	{ "Australia/Sydney", "AUSTRALIA/SYDNEY", 353, 16 },
+	{ "Australia/Tasmania", "AUSTRALIA/TASMANIA", 354, 18 },
+	{ "Australia/Victoria", "AUSTRALIA/VICTORIA", 355, 18 },
+	{ "Australia/West", "AUSTRALIA/WEST", 356, 14 },
+	{ "Australia/Yancowinna", "AUSTRALIA/YANCOWINNA", 357, 20 },
+	{ "Brazil/Acre", "BRAZIL/ACRE", 358, 11 },
+	{ "Brazil/DeNoronha", "BRAZIL/DENORONHA", 359, 16 },
+	{ "Brazil/East", "BRAZIL/EAST", 360, 11 },
+	{ "Brazil/West", "BRAZIL/WEST", 361, 11 },
+	{ "Canada/Atlantic", "CANADA/ATLANTIC", 364, 15 },
+	{ "Canada/Central", "CANADA/CENTRAL", 365, 14 },
+	{ "Canada/East-Saskatchewan", "CANADA/EAST-SASKATCHEWAN", 366, 24 },
+	{ "Canada/Eastern", "CANADA/EASTERN", 367, 14 },
+	{ "Canada/Mountain", "CANADA/MOUNTAIN", 368, 15 },
+	{ "Canada/Newfoundland", "CANADA/NEWFOUNDLAND", 369, 19 },
+	{ "Canada/Pacific", "CANADA/PACIFIC", 370, 14 },
+	{ "Canada/Saskatchewan", "CANADA/SASKATCHEWAN", 371, 19 },
+	{ "Canada/Yukon", "CANADA/YUKON", 372, 12 },
+	{ "CET", "CET", 362, 3 },
+	{ "Chile/Continental", "CHILE/CONTINENTAL", 373, 17 },
+	{ "Chile/EasterIsland", "CHILE/EASTERISLAND", 374, 18 },
+	{ "CST6CDT", "CST6CDT", 363, 7 },
+	{ "Cuba", "CUBA", 375, 4 },
+	{ "EET", "EET", 376, 3 },
+	{ "Egypt", "EGYPT", 379, 5 },
+	{ "Eire", "EIRE", 380, 4 },
+	{ "EST", "EST", 377, 3 },
+	{ "EST5EDT", "EST5EDT", 378, 7 },
+	{ "Etc/GMT", "ETC/GMT", 381, 7 },
+	{ "Etc/GMT+0", "ETC/GMT+0", 382, 9 },
+	{ "Etc/GMT+1", "ETC/GMT+1", 383, 9 },
+	{ "Etc/GMT+10", "ETC/GMT+10", 384, 10 },
+	{ "Etc/GMT+11", "ETC/GMT+11", 385, 10 },
+	{ "Etc/GMT+12", "ETC/GMT+12", 386, 10 },
+	{ "Etc/GMT+2", "ETC/GMT+2", 387, 9 },
+	{ "Etc/GMT+3", "ETC/GMT+3", 388, 9 },
+	{ "Etc/GMT+4", "ETC/GMT+4", 389, 9 },
+	{ "Etc/GMT+5", "ETC/GMT+5", 390, 9 },
+	{ "Etc/GMT+6", "ETC/GMT+6", 391, 9 },
+	{ "Etc/GMT+7", "ETC/GMT+7", 392, 9 },
+	{ "Etc/GMT+8", "ETC/GMT+8", 393, 9 },
+	{ "Etc/GMT+9", "ETC/GMT+9", 394, 9 },
+	{ "Etc/GMT-0", "ETC/GMT-0", 395, 9 },
+	{ "Etc/GMT-1", "ETC/GMT-1", 396, 9 },
+	{ "Etc/GMT-10", "ETC/GMT-10", 397, 10 },
+	{ "Etc/GMT-11", "ETC/GMT-11", 398, 10 },
+	{ "Etc/GMT-12", "ETC/GMT-12", 399, 10 },
+	{ "Etc/GMT-13", "ETC/GMT-13", 400, 10 },
+	{ "Etc/GMT-14", "ETC/GMT-14", 401, 10 },
+	{ "Etc/GMT-2", "ETC/GMT-2", 402, 9 },
+	{ "Etc/GMT-3", "ETC/GMT-3", 403, 9 },
+	{ "Etc/GMT-4", "ETC/GMT-4", 404, 9 },
+	{ "Etc/GMT-5", "ETC/GMT-5", 405, 9 },
+	{ "Etc/GMT-6", "ETC/GMT-6", 406, 9 },
+	{ "Etc/GMT-7", "ETC/GMT-7", 407, 9 },
+	{ "Etc/GMT-8", "ETC/GMT-8", 408, 9 },
+	{ "Etc/GMT-9", "ETC/GMT-9", 409, 9 },
+	{ "Etc/GMT0", "ETC/GMT0", 410, 8 },
+	{ "Etc/Greenwich", "ETC/GREENWICH", 411, 13 },
+	{ "Etc/UCT", "ETC/UCT", 412, 7 },
+	{ "Etc/Universal", "ETC/UNIVERSAL", 414, 13 },
+	{ "Etc/UTC", "ETC/UTC", 413, 7 },
+	{ "Etc/Zulu", "ETC/ZULU", 415, 8 },
+	{ "Europe/Amsterdam", "EUROPE/AMSTERDAM", 416, 16 },
+	{ "Europe/Andorra", "EUROPE/ANDORRA", 417, 14 },
+	{ "Europe/Astrakhan", "EUROPE/ASTRAKHAN", 593, 16 },
+	{ "Europe/Athens", "EUROPE/ATHENS", 418, 13 },
+	{ "Europe/Belfast", "EUROPE/BELFAST", 419, 14 },
+	{ "Europe/Belgrade", "EUROPE/BELGRADE", 420, 15 },
+	{ "Europe/Berlin", "EUROPE/BERLIN", 421, 13 },
+	{ "Europe/Bratislava", "EUROPE/BRATISLAVA", 422, 17 },
+	{ "Europe/Brussels", "EUROPE/BRUSSELS", 423, 15 },
+	{ "Europe/Bucharest", "EUROPE/BUCHAREST", 424, 16 },
+	{ "Europe/Budapest", "EUROPE/BUDAPEST", 425, 15 },
+	{ "Europe/Busingen", "EUROPE/BUSINGEN", 426, 15 },
+	{ "Europe/Chisinau", "EUROPE/CHISINAU", 427, 15 },
+	{ "Europe/Copenhagen", "EUROPE/COPENHAGEN", 428, 17 },
+	{ "Europe/Dublin", "EUROPE/DUBLIN", 429, 13 },
+	{ "Europe/Gibraltar", "EUROPE/GIBRALTAR", 430, 16 },
+	{ "Europe/Guernsey", "EUROPE/GUERNSEY", 431, 15 },
+	{ "Europe/Helsinki", "EUROPE/HELSINKI", 432, 15 },
+	{ "Europe/Isle_of_Man", "EUROPE/ISLE_OF_MAN", 433, 18 },
+	{ "Europe/Istanbul", "EUROPE/ISTANBUL", 434, 15 },
+	{ "Europe/Jersey", "EUROPE/JERSEY", 435, 13 },
+	{ "Europe/Kaliningrad", "EUROPE/KALININGRAD", 436, 18 },
+	{ "Europe/Kiev", "EUROPE/KIEV", 437, 11 },
+	{ "Europe/Kirov", "EUROPE/KIROV", 592, 12 },
+	{ "Europe/Lisbon", "EUROPE/LISBON", 438, 13 },
+	{ "Europe/Ljubljana", "EUROPE/LJUBLJANA", 439, 16 },
+	{ "Europe/London", "EUROPE/LONDON", 440, 13 },
+	{ "Europe/Luxembourg", "EUROPE/LUXEMBOURG", 441, 17 },
+	{ "Europe/Madrid", "EUROPE/MADRID", 442, 13 },
+	{ "Europe/Malta", "EUROPE/MALTA", 443, 12 },
+	{ "Europe/Mariehamn", "EUROPE/MARIEHAMN", 444, 16 },
+	{ "Europe/Minsk", "EUROPE/MINSK", 445, 12 },
+	{ "Europe/Monaco", "EUROPE/MONACO", 446, 13 },
+	{ "Europe/Moscow", "EUROPE/MOSCOW", 447, 13 },
+	{ "Europe/Nicosia", "EUROPE/NICOSIA", 448, 14 },
+	{ "Europe/Oslo", "EUROPE/OSLO", 449, 11 },
+	{ "Europe/Paris", "EUROPE/PARIS", 450, 12 },
+	{ "Europe/Podgorica", "EUROPE/PODGORICA", 451, 16 },
+	{ "Europe/Prague", "EUROPE/PRAGUE", 452, 13 },
+	{ "Europe/Riga", "EUROPE/RIGA", 453, 11 },
+	{ "Europe/Rome", "EUROPE/ROME", 454, 11 },
+	{ "Europe/Samara", "EUROPE/SAMARA", 455, 13 },
+	{ "Europe/San_Marino", "EUROPE/SAN_MARINO", 456, 17 },
+	{ "Europe/Sarajevo", "EUROPE/SARAJEVO", 457, 15 },
+	{ "Europe/Saratov", "EUROPE/SARATOV", 591, 14 },
+	{ "Europe/Simferopol", "EUROPE/SIMFEROPOL", 458, 17 },
+	{ "Europe/Skopje", "EUROPE/SKOPJE", 459, 13 },
+	{ "Europe/Sofia", "EUROPE/SOFIA", 460, 12 },
+	{ "Europe/Stockholm", "EUROPE/STOCKHOLM", 461, 16 },
+	{ "Europe/Tallinn", "EUROPE/TALLINN", 462, 14 },
+	{ "Europe/Tirane", "EUROPE/TIRANE", 463, 13 },
+	{ "Europe/Tiraspol", "EUROPE/TIRASPOL", 464, 15 },
+	{ "Europe/Ulyanovsk", "EUROPE/ULYANOVSK", 590, 16 },
+	{ "Europe/Uzhgorod", "EUROPE/UZHGOROD", 465, 15 },
+	{ "Europe/Vaduz", "EUROPE/VADUZ", 466, 12 },
+	{ "Europe/Vatican", "EUROPE/VATICAN", 467, 14 },
+	{ "Europe/Vienna", "EUROPE/VIENNA", 468, 13 },
+	{ "Europe/Vilnius", "EUROPE/VILNIUS", 469, 14 },
+	{ "Europe/Volgograd", "EUROPE/VOLGOGRAD", 470, 16 },
+	{ "Europe/Warsaw", "EUROPE/WARSAW", 471, 13 },
+	{ "Europe/Zagreb", "EUROPE/ZAGREB", 472, 13 },
+	{ "Europe/Zaporozhye", "EUROPE/ZAPOROZHYE", 473, 17 },
+	{ "Europe/Zurich", "EUROPE/ZURICH", 474, 13 },
+	{ "GB", "GB", 475, 2 },
+	{ "GB-Eire", "GB-EIRE", 476, 7 },
+	{ "GMT", "GMT", 477, 3 },
+	{ "GMT+0", "GMT+0", 478, 5 },
+	{ "GMT-0", "GMT-0", 479, 5 },
+	{ "GMT0", "GMT0", 480, 4 },
+	{ "Greenwich", "GREENWICH", 481, 9 },
+	{ "Hongkong", "HONGKONG", 483, 8 },
+	{ "HST", "HST", 482, 3 },
+	{ "Iceland", "ICELAND", 484, 7 },
+	{ "Indian/Antananarivo", "INDIAN/ANTANANARIVO", 485, 19 },
+	{ "Indian/Chagos", "INDIAN/CHAGOS", 486, 13 },
+	{ "Indian/Christmas", "INDIAN/CHRISTMAS", 487, 16 },
+	{ "Indian/Cocos", "INDIAN/COCOS", 488, 12 },
+	{ "Indian/Comoro", "INDIAN/COMORO", 489, 13 },
+	{ "Indian/Kerguelen", "INDIAN/KERGUELEN", 490, 16 },
+	{ "Indian/Mahe", "INDIAN/MAHE", 491, 11 },
+	{ "Indian/Maldives", "INDIAN/MALDIVES", 492, 15 },
+	{ "Indian/Mauritius", "INDIAN/MAURITIUS", 493, 16 },
+	{ "Indian/Mayotte", "INDIAN/MAYOTTE", 494, 14 },
+	{ "Indian/Reunion", "INDIAN/REUNION", 495, 14 },
+	{ "Iran", "IRAN", 496, 4 },
+	{ "Israel", "ISRAEL", 497, 6 },
+	{ "Jamaica", "JAMAICA", 498, 7 },
+	{ "Japan", "JAPAN", 499, 5 },
+	{ "Kwajalein", "KWAJALEIN", 500, 9 },
+	{ "Libya", "LIBYA", 501, 5 },
+	{ "MET", "MET", 502, 3 },
+	{ "Mexico/BajaNorte", "MEXICO/BAJANORTE", 505, 16 },
+	{ "Mexico/BajaSur", "MEXICO/BAJASUR", 506, 14 },
+	{ "Mexico/General", "MEXICO/GENERAL", 507, 14 },
+	{ "MST", "MST", 503, 3 },
+	{ "MST7MDT", "MST7MDT", 504, 7 },
+	{ "Navajo", "NAVAJO", 510, 6 },
+	{ "NZ", "NZ", 508, 2 },
+	{ "NZ-CHAT", "NZ-CHAT", 509, 7 },
+	{ "Pacific/Apia", "PACIFIC/APIA", 513, 12 },
+	{ "Pacific/Auckland", "PACIFIC/AUCKLAND", 514, 16 },
+	{ "Pacific/Bougainville", "PACIFIC/BOUGAINVILLE", 580, 20 },
+	{ "Pacific/Chatham", "PACIFIC/CHATHAM", 515, 15 },
+	{ "Pacific/Chuuk", "PACIFIC/CHUUK", 516, 13 },
+	{ "Pacific/Easter", "PACIFIC/EASTER", 517, 14 },
+	{ "Pacific/Efate", "PACIFIC/EFATE", 518, 13 },
+	{ "Pacific/Enderbury", "PACIFIC/ENDERBURY", 519, 17 },
+	{ "Pacific/Fakaofo", "PACIFIC/FAKAOFO", 520, 15 },
+	{ "Pacific/Fiji", "PACIFIC/FIJI", 521, 12 },
+	{ "Pacific/Funafuti", "PACIFIC/FUNAFUTI", 522, 16 },
+	{ "Pacific/Galapagos", "PACIFIC/GALAPAGOS", 523, 17 },
+	{ "Pacific/Gambier", "PACIFIC/GAMBIER", 524, 15 },
+	{ "Pacific/Guadalcanal", "PACIFIC/GUADALCANAL", 525, 19 },
+	{ "Pacific/Guam", "PACIFIC/GUAM", 526, 12 },
+	{ "Pacific/Honolulu", "PACIFIC/HONOLULU", 527, 16 },
+	{ "Pacific/Johnston", "PACIFIC/JOHNSTON", 528, 16 },
+	{ "Pacific/Kiritimati", "PACIFIC/KIRITIMATI", 529, 18 },
+	{ "Pacific/Kosrae", "PACIFIC/KOSRAE", 530, 14 },
+	{ "Pacific/Kwajalein", "PACIFIC/KWAJALEIN", 531, 17 },
+	{ "Pacific/Majuro", "PACIFIC/MAJURO", 532, 14 },
+	{ "Pacific/Marquesas", "PACIFIC/MARQUESAS", 533, 17 },
+	{ "Pacific/Midway", "PACIFIC/MIDWAY", 534, 14 },
+	{ "Pacific/Nauru", "PACIFIC/NAURU", 535, 13 },
+	{ "Pacific/Niue", "PACIFIC/NIUE", 536, 12 },
+	{ "Pacific/Norfolk", "PACIFIC/NORFOLK", 537, 15 },
+	{ "Pacific/Noumea", "PACIFIC/NOUMEA", 538, 14 },
+	{ "Pacific/Pago_Pago", "PACIFIC/PAGO_PAGO", 539, 17 },
+	{ "Pacific/Palau", "PACIFIC/PALAU", 540, 13 },
+	{ "Pacific/Pitcairn", "PACIFIC/PITCAIRN", 541, 16 },
+	{ "Pacific/Pohnpei", "PACIFIC/POHNPEI", 542, 15 },
+	{ "Pacific/Ponape", "PACIFIC/PONAPE", 543, 14 },
+	{ "Pacific/Port_Moresby", "PACIFIC/PORT_MORESBY", 544, 20 },
+	{ "Pacific/Rarotonga", "PACIFIC/RAROTONGA", 545, 17 },
+	{ "Pacific/Saipan", "PACIFIC/SAIPAN", 546, 14 },
+	{ "Pacific/Samoa", "PACIFIC/SAMOA", 547, 13 },
+	{ "Pacific/Tahiti", "PACIFIC/TAHITI", 548, 14 },
+	{ "Pacific/Tarawa", "PACIFIC/TARAWA", 549, 14 },
+	{ "Pacific/Tongatapu", "PACIFIC/TONGATAPU", 550, 17 },
+	{ "Pacific/Truk", "PACIFIC/TRUK", 551, 12 },
+	{ "Pacific/Wake", "PACIFIC/WAKE", 552, 12 },
+	{ "Pacific/Wallis", "PACIFIC/WALLIS", 553, 14 },
+	{ "Pacific/Yap", "PACIFIC/YAP", 554, 11 },
+	{ "Poland", "POLAND", 555, 6 },
+	{ "Portugal", "PORTUGAL", 556, 8 },
+	{ "posixrules", "POSIXRULES", 594, 10 },
+	{ "PRC", "PRC", 511, 3 },
+	{ "PST8PDT", "PST8PDT", 512, 7 },
+	{ "ROC", "ROC", 557, 3 },
+	{ "ROK", "ROK", 558, 3 },
+	{ "Singapore", "SINGAPORE", 559, 9 },
+	{ "Turkey", "TURKEY", 560, 6 },
+	{ "UCT", "UCT", 561, 3 },
+	{ "Universal", "UNIVERSAL", 576, 9 },
+	{ "US/Alaska", "US/ALASKA", 562, 9 },
+	{ "US/Aleutian", "US/ALEUTIAN", 563, 11 },
+	{ "US/Arizona", "US/ARIZONA", 564, 10 },
+	{ "US/Central", "US/CENTRAL", 565, 10 },
+	{ "US/East-Indiana", "US/EAST-INDIANA", 566, 15 },
+	{ "US/Eastern", "US/EASTERN", 567, 10 },
+	{ "US/Hawaii", "US/HAWAII", 568, 9 },
+	{ "US/Indiana-Starke", "US/INDIANA-STARKE", 569, 17 },
+	{ "US/Michigan", "US/MICHIGAN", 570, 11 },
+	{ "US/Mountain", "US/MOUNTAIN", 571, 11 },
+	{ "US/Pacific", "US/PACIFIC", 572, 10 },
+	{ "US/Pacific-New", "US/PACIFIC-NEW", 573, 14 },
+	{ "US/Samoa", "US/SAMOA", 574, 8 },
+	{ "UTC", "UTC", 575, 3 },
+	{ "W-SU", "W-SU", 577, 4 },
+	{ "WET", "WET", 578, 3 },
+	{ "Zulu", "ZULU", 579, 4 },
 };
 
 static const struct timezone_to_id *timezones_by_id[] = {
@@ -1200,39 +1203,92 @@ static const struct timezone_to_id *timezones_by_id[] = {
 
 #define NTIMEZONES (sizeof(timezones)/sizeof(timezones[0]))
 
-static const char *tzid_to_tzname(int id)
-{
-	return timezones_by_id[id - 1]->name;
-}
-
-static int tzname_to_tzid(const char *name)
-{
-	char uppername[TZ_STRLEN_MAX + 1] = {0};
-	char *p;
-	int first, last, middle;
-
-	p = uppername;
-	while (*name)
-		*p++ = pg_toupper((unsigned char) *name++);
-	*p = '\0';
-
-	first = 0;
-	last = NTIMEZONES - 1;
-	middle = (first + last) / 2;
+#define TZHASH_SEED 2166136261u
+#define TZHASH_BUCKET_BITS 8
+#define TZHASH_SIZE 1024
 
-	while(first <= last)
-	{
-		int cmp = strcmp(timezones[middle].nameupper, uppername);
-
-		if(cmp < 0)
-			first = middle + 1;
-		else if(cmp == 0)
-			return timezones[middle].id;
-		else
-			last = middle - 1;
-
-		middle = (first + last) / 2;
-	}
+static const uint16 tzhash_displacements[256] = {
+	0, 0, 4, 0, 0, 2, 0, 0, 0, 21, 0, 0, 1, 2, 1, 7,
+	0, 14, 4, 0, 0, 0, 10, 4, 1, 0, 0, 0, 4, 0, 0, 0,
+	11, 0, 1, 4, 1, 1, 0, 8, 0, 1, 3, 2, 0, 0, 0, 8,
+	0, 0, 2, 0, 2, 0, 0, 1, 0, 1, 0, 0, 5, 6, 0, 2,
+	0, 0, 0, 0, 0, 1, 2, 8, 0, 0, 0, 3, 0, 0, 4, 5,
+	0, 7, 8, 0, 6, 1, 4, 0, 0, 0, 3, 1, 9, 8, 0, 0,
+	2, 0, 1, 0, 0, 0, 16, 0, 0, 0, 4, 0, 18, 0, 0, 0,
+	0, 0, 0, 0, 0, 5, 0, 1, 0, 0, 0, 0, 0, 12, 8, 6,
+	4, 4, 0, 0, 1, 2, 0, 0, 0, 0, 2, 0, 10, 0, 1, 4,
+	2, 0, 2, 0, 0, 0, 0, 3, 3, 0, 5, 5, 1, 2, 1, 0,
+	2, 0, 0, 6, 3, 1, 0, 0, 0, 0, 1, 0, 0, 5, 0, 1,
+	0, 0, 1, 0, 1, 12, 0, 2, 1, 1, 0, 1, 1, 0, 0, 1,
+	8, 0, 5, 0, 2, 2, 1, 13, 0, 7, 0, 1, 1, 4, 0, 1,
+	1, 1, 5, 1, 1, 0, 11, 1, 0, 0, 2, 0, 11, 4, 2, 11,
+	5, 4, 1, 1, 20, 1, 0, 2, 3, 0, 1, 15, 1, 0, 2, 2,
+	1, 21, 0, 3, 2, 0, 0, 6, 2, 0, 2, 13, 0, 3, 0, 14,
+};
 
-	return 0;
-}
+static const uint16 tzhash_ids[1024] = {
+	321, 347, 530, 209, 378, 0, 0, 207, 0, 138, 546, 0, 427, 0, 227, 83,
+	0, 0, 0, 424, 503, 0, 0, 403, 136, 99, 342, 523, 0, 276, 491, 0,
+	0, 0, 0, 0, 175, 0, 0, 226, 551, 73, 230, 0, 0, 0, 22, 0,
+	510, 392, 47, 283, 362, 419, 60, 348, 147, 0, 0, 199, 23, 460, 0, 0,
+	0, 0, 174, 100, 0, 0, 0, 0, 44, 0, 0, 0, 0, 0, 575, 204,
+	407, 139, 367, 56, 409, 21, 0, 219, 265, 57, 0, 242, 0, 432, 113, 89,
+	141, 0, 287, 0, 0, 0, 0, 0, 469, 0, 591, 0, 304, 13, 67, 155,
+	356, 531, 402, 447, 0, 320, 0, 383, 0, 0, 0, 0, 390, 0, 0, 0,
+	554, 0, 0, 425, 335, 232, 492, 0, 98, 0, 0, 272, 0, 0, 0, 0,
+	0, 240, 38, 312, 183, 459, 0, 309, 0, 0, 0, 0, 0, 0, 0, 0,
+	526, 181, 590, 416, 34, 475, 260, 20, 231, 5, 0, 261, 545, 0, 0, 0,
+	380, 334, 159, 297, 443, 206, 284, 152, 496, 361, 562, 473, 8, 441, 211, 198,
+	188, 0, 128, 585, 371, 251, 173, 512, 14, 82, 0, 0, 540, 279, 256, 480,
+	0, 217, 0, 0, 0, 0, 0, 589, 0, 0, 118, 439, 514, 0, 592, 0,
+	81, 521, 355, 0, 35, 0, 415, 293, 517, 280, 572, 453, 0, 0, 97, 0,
+	463, 0, 0, 0, 476, 385, 0, 250, 154, 420, 341, 0, 0, 59, 536, 584,
+	458, 0, 0, 25, 0, 479, 292, 0, 15, 518, 103, 446, 0, 537, 101, 192,
+	0, 0, 0, 46, 0, 200, 0, 535, 26, 0, 0, 322, 0, 315, 114, 0,
+	253, 58, 421, 9, 0, 481, 351, 324, 0, 483, 262, 0, 182, 498, 176, 489,
+	331, 336, 0, 353, 0, 0, 0, 0, 0, 0, 471, 185, 0, 0, 462, 0,
+	0, 0, 0, 0, 488, 0, 263, 319, 70, 434, 0, 17, 166, 210, 37, 68,
+	450, 0, 135, 580, 437, 3, 0, 39, 0, 0, 368, 0, 0, 0, 0, 0,
+	0, 88, 484, 0, 0, 360, 0, 156, 478, 66, 0, 0, 244, 387, 184, 520,
+	417, 0, 0, 0, 0, 187, 0, 0, 259, 0, 548, 313, 0, 79, 102, 0,
+	36, 50, 90, 338, 0, 0, 0, 157, 0, 456, 0, 0, 45, 221, 0, 0,
+	254, 329, 318, 0, 0, 112, 0, 0, 0, 169, 0, 0, 310, 0, 393, 274,
+	0, 0, 323, 449, 559, 504, 552, 127, 0, 0, 0, 0, 0, 0, 468, 0,
+	0, 490, 0, 0, 4, 372, 570, 41, 0, 474, 594, 494, 0, 0, 0, 87,
+	0, 0, 277, 0, 291, 524, 28, 0, 85, 0, 401, 467, 110, 172, 499, 92,
+	389, 0, 108, 388, 528, 130, 145, 0, 0, 161, 0, 0, 529, 0, 0, 258,
+	55, 311, 486, 0, 0, 0, 0, 0, 0, 171, 196, 0, 0, 565, 542, 316,
+	0, 0, 271, 178, 0, 0, 0, 317, 0, 369, 0, 109, 65, 0, 0, 414,
+	218, 543, 264, 544, 69, 472, 493, 286, 180, 470, 247, 349, 448, 94, 201, 78,
+	0, 549, 0, 0, 370, 0, 0, 391, 193, 52, 0, 578, 411, 106, 455, 0,
+	0, 0, 555, 485, 0, 452, 0, 0, 582, 96, 0, 76, 133, 42, 563, 0,
+	332, 0, 377, 0, 0, 32, 129, 1, 306, 282, 105, 0, 222, 532, 168, 345,
+	0, 158, 0, 0, 0, 0, 0, 0, 0, 330, 165, 0, 71, 119, 561, 0,
+	579, 0, 0, 19, 0, 33, 107, 191, 364, 0, 0, 0, 249, 527, 0, 0,
+	167, 117, 435, 51, 442, 426, 506, 0, 270, 84, 550, 213, 179, 0, 373, 121,
+	0, 0, 0, 0, 151, 0, 95, 0, 0, 116, 0, 0, 576, 0, 134, 328,
+	125, 0, 296, 86, 0, 0, 0, 0, 522, 0, 205, 376, 0, 149, 507, 0,
+	31, 0, 314, 0, 461, 243, 0, 177, 120, 0, 241, 357, 0, 327, 0, 61,
+	0, 0, 0, 0, 163, 0, 422, 0, 0, 0, 464, 337, 382, 444, 0, 273,
+	229, 225, 0, 513, 123, 234, 27, 547, 326, 54, 577, 299, 0, 560, 482, 509,
+	267, 0, 2, 0, 0, 410, 0, 0, 255, 343, 593, 0, 48, 72, 49, 29,
+	215, 359, 399, 0, 301, 278, 153, 466, 0, 0, 501, 0, 525, 0, 0, 558,
+	288, 0, 564, 0, 0, 0, 131, 252, 300, 0, 43, 202, 268, 111, 233, 379,
+	487, 162, 6, 541, 581, 568, 195, 412, 40, 0, 363, 7, 454, 238, 126, 308,
+	295, 0, 228, 384, 428, 0, 400, 24, 358, 340, 122, 0, 124, 515, 0, 398,
+	0, 346, 0, 0, 290, 433, 0, 0, 0, 53, 0, 80, 0, 0, 438, 339,
+	0, 0, 0, 516, 0, 0, 0, 0, 394, 0, 93, 350, 220, 16, 208, 0,
+	406, 413, 395, 144, 146, 0, 465, 0, 0, 0, 302, 0, 0, 294, 142, 566,
+	0, 0, 115, 0, 0, 0, 0, 374, 285, 511, 366, 216, 0, 214, 281, 0,
+	91, 0, 0, 569, 0, 189, 408, 477, 386, 0, 0, 0, 500, 190, 0, 556,
+	0, 0, 0, 0, 396, 0, 354, 203, 246, 298, 0, 0, 0, 194, 365, 381,
+	0, 344, 0, 0, 0, 18, 132, 0, 0, 0, 0, 0, 64, 0, 0, 0,
+	137, 423, 305, 451, 257, 333, 538, 352, 0, 0, 0, 30, 418, 235, 539, 505,
+	0, 77, 0, 0, 431, 104, 0, 0, 0, 223, 237, 588, 0, 186, 583, 405,
+	553, 266, 11, 430, 0, 0, 0, 586, 0, 245, 0, 0, 404, 497, 557, 0,
+	0, 457, 0, 0, 502, 436, 445, 375, 0, 0, 224, 0, 0, 495, 236, 0,
+	0, 0, 0, 0, 0, 170, 0, 0, 440, 571, 0, 275, 150, 0, 239, 567,
+	533, 574, 248, 307, 289, 0, 63, 397, 212, 0, 164, 0, 573, 0, 0, 0,
+	10, 160, 0, 0, 62, 74, 0, 0, 0, 0, 148, 429, 0, 0, 0, 0,
+	143, 0, 303, 0, 519, 75, 0, 12, 140, 508, 325, 587, 197, 0, 534, 269,
+};